@@ -0,0 +1,1497 @@
+/**
+ * ABCU Course Management System - Benchmark Suite
+ *
+ * Measures the loader, hash table and sort paths of ProjectTwo.cpp across
+ * catalog sizes and writes the results as JSON so builds can be compared.
+ *
+ * Usage: ProjectTwoBenchmark [--max-size N] [--validate-max N] [--lookups N]
+ *                            [--mixed-courses N] [--mixed-ops N] [--mixed-threads N]
+ *                            [--read-percent N] [--catalog-files N] [--catalog-courses N]
+ *                            [--wal-courses N] [--wal-edits N] [--history-courses N]
+ *                            [--history-terms N] [--history-change-percent N] [--stream-courses N]
+ *                            [--columnar-courses N] [--dag-courses N] [--dag-depth N]
+ *                            [--seed N] [--label TEXT] [--json FILE]
+ */
+#define PROJECTTWO_NO_MAIN
+#include "ProjectTwo.cpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
+/**
+ * Benchmark settings taken from the command line
+ */
+struct BenchmarkOptions {
+    long long maxSize = 1000000;      // Largest catalog size to run (10M is opt-in)
+    long long validateMax = 2000;     // Largest catalog size run through legacy validateFile (quadratic)
+    long long lookups = 200000;       // Lookups timed per catalog size for hits and for misses
+    unsigned int seed = 42;           // Seed for catalog generation and lookup keys
+    long long mixedCourses = 100000;  // Courses preloaded for the concurrent mixed workload
+    long long mixedOps = 200000;      // Operations per thread in the mixed workload
+    int mixedMaxThreads = 64;         // Thread counts 1, 2, 4, ... up to this value
+    int readPercent = 90;             // Share of lookups in the mixed workload (rest upsert/erase)
+    int catalogFiles = 8;             // Files the multi-catalog load is split across (0 = skip)
+    long long catalogCourses = 200000; // Courses in the multi-catalog load
+    long long walCourses = 200000;    // Courses in the table behind the edit log benchmark
+    long long walEdits = 4096;        // Logged edits per group commit size (0 = skip)
+    long long historyCourses = 200000; // Courses in each term of the catalog history benchmark
+    int historyTerms = 8;             // Terms recorded in the history benchmark (0 = skip)
+    int historyChangePercent = 2;     // Courses renamed between consecutive terms
+    long long streamCourses = 1000000; // Courses in the phased versus streamed load comparison (0 = skip)
+    long long columnarCourses = 1000000; // Courses in the columnar export/import benchmark (0 = skip)
+    long long dagCourses = 200000;    // Courses in the prerequisite DAG of the dependency benchmark (0 = skip)
+    int dagDepth = 8;                 // Levels in that DAG (longest prerequisite chain)
+    string label = "default";         // Free-form build label stored with the results
+    string jsonPath = "bench_results.json"; // Machine-readable output file
+};
+
+/**
+ * Measurements for a single catalog size
+ */
+struct BenchmarkResult {
+    long long courses = 0;           // Number of courses in the catalog
+    long long fileBytes = 0;         // Size of the generated CSV file
+    double readSeconds = 0.0;        // readFileLines
+    double validateSeconds = 0.0;    // validateFileCollectAll (the loader's validator)
+    double legacyValidateSeconds = -1.0; // validateFile (-1 when skipped)
+    double insertSeconds = 0.0;      // createCourseObject + insertCourseIntoTable for every line
+    int resizeCount = 0;             // Resizes performed while inserting
+    double resizeSeconds = 0.0;      // One extra resizeHashTable on the loaded table
+    double hitNanoseconds = 0.0;     // searchCourse per successful lookup
+    double missNanoseconds = 0.0;    // searchCourse per failed lookup
+    double suggestNanoseconds = 0.0; // searchCourse miss + suggestCourses per mistyped course number
+    long long suggestLookups = 0;    // Mistyped lookups timed (fewer on large catalogs)
+    double suggestionBytesPerCourse = 0.0; // getSuggestionIndexBytes / courses
+    double sortSeconds = 0.0;        // collectAllCourses + sortCoursesAlphanumerically
+    double nameBuildSeconds = 0.0;   // buildNameIndex
+    long long nameQueries = 0;       // Queries timed per kind (fewer on large catalogs)
+    double nameAndNanos = 0.0;       // searchCourseNames per two-term AND query
+    double nameOrNanos = 0.0;        // searchCourseNames per two-term OR query
+    double namePhraseNanos = 0.0;    // searchCourseNames per two-term quoted phrase
+    double nameMatches = 0.0;        // Mean ranked matches per query across all three kinds
+    double nameBytesPerCourse = 0.0; // getNameIndexBytes / courses
+    double tableBytesPerCourse = 0.0;   // getHashTableBytes / courses
+    double compactBytesPerCourse = 0.0; // getCompactCatalogBytes / courses
+    double compactBuildSeconds = 0.0;   // buildCompactCatalog
+    double tableScanSeconds = 0.0;      // Touch every name and prerequisite through the hash table
+    double compactScanSeconds = 0.0;    // Same scan over the compact catalog (already in order)
+    TableMemory memory;              // measureHashTableMemory() of the loaded table
+    long long rssGrowthBytes = 0;    // Process RSS added by parse + insert (what the table really took)
+    long long peakRssBytes = 0;      // Process peak resident set size while this size ran
+    bool peakPerSize = false;        // Peak covers only this size (resetPeakRss() worked), else cumulative
+};
+
+/**
+ * Measurements for one run of the concurrent mixed read/write workload
+ */
+struct MixedResult {
+    int shards = 0;            // Shards in the ShardedHashTable (1 = one global lock)
+    int threads = 0;           // Worker threads
+    long long operations = 0;  // Total operations across threads
+    double seconds = 0.0;      // Wall time for all workers
+};
+
+/**
+ * Measurements for loading one catalog split across several files
+ */
+struct CatalogResult {
+    int files = 0;               // Catalog files
+    long long courses = 0;       // Courses across all files
+    unsigned int threads = 0;    // Worker threads used by loadCatalogFiles
+    double singleSeconds = 0.0;  // Read + validate + insert of the same rows as one file
+    double multiSeconds = 0.0;   // loadCatalogFiles over the split files
+};
+
+/**
+ * Edit throughput for one group commit size
+ */
+struct WalRun {
+    int batch = 0;           // Edits per fsync
+    long long edits = 0;     // Edits logged
+    double seconds = 0.0;    // Time for all edits including the final commit
+    size_t syncs = 0;        // fsync calls on the log
+};
+
+/**
+ * Edit log measurements
+ */
+struct WalResult {
+    long long courses = 0;         // Courses in the table
+    double checkpointSeconds = 0.0; // Writing the first checkpoint of the table
+    double recoverySeconds = 0.0;  // Checkpoint + log replay into an empty table
+    double csvReloadSeconds = 0.0; // Read + validate + insert of the same catalog as CSV
+    vector<WalRun> runs;           // One run per group commit size
+};
+
+/**
+ * Catalog history measurements
+ */
+struct HistoryResult {
+    long long courses = 0;          // Courses per term
+    int terms = 0;                  // Terms recorded
+    int changePercent = 0;          // Courses changed between terms
+    size_t records = 0;             // Records in the history after the last term
+    size_t historyBytes = 0;        // getCatalogHistoryBytes() after the last term
+    size_t snapshotBytes = 0;       // One hash table per term (getHashTableBytes() x terms)
+    double recordSeconds = 0.0;     // Mean recordCatalogTerm() time per term
+    double asOfNanos = 0.0;         // Mean as-of searchCourse() time
+};
+
+/**
+ * Phased versus streamed single-file load
+ */
+struct StreamResult {
+    long long courses = 0;          // Courses in the file
+    long long fileBytes = 0;        // Size of the file
+    double phasedSeconds = 0.0;     // readFileLines + validateFileCollectAll + insert
+    size_t lineBytes = 0;           // Memory of the lines the phased load holds at once
+    double streamedSeconds = 0.0;   // streamCatalogFile (pipeline + checks)
+    size_t bufferedBytes = 0;       // Most file bytes the pipeline held at once
+    size_t readerWaits = 0;         // Reader blocks held back by a full queue
+    size_t parserWaits = 0;         // Parser blocks held back by a full queue
+};
+
+/**
+ * Columnar export and projected import of one projection
+ */
+struct ColumnarRead {
+    string projection;          // "all", "keys", "names" or "prerequisites"
+    size_t bytesRead = 0;       // Bytes read from the file
+    double seconds = 0.0;       // importColumnarCatalog() time
+};
+
+/**
+ * Columnar export measurements
+ */
+struct ColumnarResult {
+    long long courses = 0;          // Courses exported
+    size_t fileBytes = 0;           // Export size
+    double exportSeconds = 0.0;     // exportColumnarCatalog() time
+    double rawWriteSeconds = 0.0;   // Writing the same number of bytes from one buffer
+    double rawReadSeconds = 0.0;    // Reading the whole file into one buffer
+    vector<ColumnarRead> reads;     // One import per projection
+};
+
+/**
+ * Dependency index measurements on a layered prerequisite DAG
+ */
+struct DependencyResult {
+    long long courses = 0;          // Courses in the DAG
+    int depth = 0;                  // DAG levels
+    size_t edges = 0;               // Prerequisite edges
+    double buildSeconds = 0.0;      // buildDependencyIndex() time
+    double directNanos = 0.0;       // getDirectDependents() per lookup
+    int impactQueries = 0;          // Distinct courses asked for their impact set
+    double impactSize = 0.0;        // Mean courses per impact set
+    double coldImpactNanos = 0.0;   // getImpactSet() per query with an empty cache
+    double memoImpactNanos = 0.0;   // getImpactSet() per query answered from the cache
+};
+
+const int DAG_IMPACT_QUERIES = 256; // Impact sets computed per dependency benchmark run
+const long long SUGGESTION_COURSE_BUDGET = 100000000; // Suggested lookups x courses per size (each compares candidates)
+const long long NAME_QUERIES = 1000;             // Most name queries timed per kind (AND, OR, phrase) per size
+const long long NAME_QUERY_COURSE_BUDGET = 10000000; // Queries x courses per kind; each query matches ~15% of courses
+
+// Words benchmark course names are drawn from (and name queries are built from)
+const char* const BENCHMARK_NAME_WORDS[] = { "Introduction", "to", "Data", "Structures", "Advanced", "Theory",
+    "Programming", "Systems", "Design", "Analysis", "Applied", "Methods", "Seminar", "Laboratory" };
+const int BENCHMARK_NAME_WORD_COUNT = sizeof(BENCHMARK_NAME_WORDS) / sizeof(BENCHMARK_NAME_WORDS[0]);
+
+/**
+ * Function: Seconds Since
+ * Purpose: Converts the time elapsed since a start point to seconds
+ * Input: start - time point captured before the measured work
+ * Output: Elapsed seconds
+ */
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Function: Silence Output
+ * Purpose: Discards console output (resize messages) while a measurement runs
+ * Output: Previous stream buffer, to be passed to restoreOutput
+ */
+streambuf* silenceOutput() {
+    return cout.rdbuf(nullptr);
+}
+
+/**
+ * Function: Restore Output
+ * Purpose: Re-enables console output after silenceOutput
+ * Input: previous - stream buffer returned by silenceOutput
+ */
+void restoreOutput(streambuf* previous) {
+    cout.rdbuf(previous);
+    cout.clear();
+}
+
+/**
+ * Function: Benchmark Course Number
+ * Purpose: Builds the course number for a benchmark course id (e.g. "CSCI0000042")
+ * Input: id - course id
+ * Output: Course number with a department prefix and zero-padded id
+ */
+string benchmarkCourseNumber(long long id) {
+    static const char* departments[] = { "CSCI", "MATH", "PHYS", "CHEM", "BIOL", "ENGL", "HIST", "ECON" };
+    char digits[16];
+    snprintf(digits, sizeof(digits), "%07lld", id);
+    return string(departments[id % 8]) + digits;
+}
+
+/**
+ * Function: Write Benchmark Catalog
+ * Purpose: Writes a catalog CSV in the format parseLine accepts; every course
+ *          lists 0-2 prerequisites chosen from earlier courses so the file is valid
+ * Input: path - output file, courses - number of courses, seed - random seed,
+ *        courseNumbers - reference to vector that receives every course number
+ * Output: Size of the written file in bytes, or -1 on error
+ */
+long long writeBenchmarkCatalog(const string& path, long long courses, unsigned int seed, vector<string>& courseNumbers) {
+    ofstream file(path, ios::binary);
+    if (!file.is_open()) {
+        return -1;
+    }
+
+    mt19937 rng(seed);
+    courseNumbers.clear();
+    courseNumbers.reserve((size_t)courses);
+
+    string line;
+    for (long long id = 0; id < courses; id++) {
+        courseNumbers.push_back(benchmarkCourseNumber(id));
+
+        line = courseNumbers.back();
+        line += ',';
+        int nameWords = 2 + (int)(rng() % 4);
+        for (int w = 0; w < nameWords; w++) {
+            if (w > 0) {
+                line += ' ';
+            }
+            line += BENCHMARK_NAME_WORDS[rng() % BENCHMARK_NAME_WORD_COUNT];
+        }
+
+        int prerequisites = id == 0 ? 0 : (int)(rng() % 3);
+        for (int p = 0; p < prerequisites; p++) {
+            line += ',';
+            line += courseNumbers[rng() % id];
+        }
+
+        line += '\n';
+        file.write(line.data(), line.size());
+    }
+
+    return (long long)file.tellp();
+}
+
+/**
+ * Function: Run Benchmark Size
+ * Purpose: Measures every benchmarked path for one catalog size
+ * Input: options - benchmark settings, courses - catalog size, result - reference to result to fill
+ * Output: true if the size completed, false on I/O error
+ */
+bool runBenchmarkSize(const BenchmarkOptions& options, long long courses, BenchmarkResult& result) {
+    result = BenchmarkResult();
+    result.courses = courses;
+    result.peakPerSize = resetPeakRss();
+
+    string path = "bench_catalog_" + to_string(courses) + ".csv";
+    vector<string> courseNumbers;
+    result.fileBytes = writeBenchmarkCatalog(path, courses, options.seed, courseNumbers);
+    if (result.fileBytes < 0) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+
+    streambuf* previous = silenceOutput();
+
+    // Read
+    vector<string> lines;
+    vector<size_t> lineNumbers;
+    auto start = chrono::steady_clock::now();
+    bool read = readFileLines(path, lines, &lineNumbers);
+    result.readSeconds = secondsSince(start);
+    remove(path.c_str());
+
+    if (!read) {
+        restoreOutput(previous);
+        cout << "Error: Cannot read '" << path << "'" << endl;
+        return false;
+    }
+
+    // Validate with the parallel collect-all validator the loader uses
+    vector<ValidationIssue> issues;
+    start = chrono::steady_clock::now();
+    validateFileCollectAll(lines, lineNumbers, issues);
+    result.validateSeconds = secondsSince(start);
+    vector<size_t>().swap(lineNumbers);
+
+    // The original first-error validator is quadratic, so only small sizes by default
+    if (courses <= options.validateMax) {
+        start = chrono::steady_clock::now();
+        validateFile(lines);
+        result.legacyValidateSeconds = secondsSince(start);
+    }
+
+    // Parse and insert
+    long long rssBefore = (long long)getCurrentRssBytes();
+    HashTable table = initializeHashTable(16);
+    start = chrono::steady_clock::now();
+    for (const string& line : lines) {
+        Course course;
+        if (createCourseObject(line, course)) {
+            insertCourseIntoTable(table, course);
+        }
+    }
+    result.insertSeconds = secondsSince(start);
+    result.rssGrowthBytes = (long long)getCurrentRssBytes() - rssBefore;
+    for (int capacity = 16; capacity < table.capacity; capacity *= 2) {
+        result.resizeCount++;
+    }
+
+    // Release the raw lines before lookups so they do not distort the cache
+    vector<string>().swap(lines);
+
+    // Lookups: hits use random existing keys, misses use keys from an unused department
+    mt19937 rng(options.seed + 1);
+    vector<string> hitKeys;
+    vector<string> missKeys;
+    for (long long i = 0; i < options.lookups; i++) {
+        hitKeys.push_back(courseNumbers[rng() % courseNumbers.size()]);
+        missKeys.push_back("ZZZZ" + courseNumbers[rng() % courseNumbers.size()].substr(4));
+    }
+
+    Course found;
+    long long hits = 0;
+    start = chrono::steady_clock::now();
+    for (const string& key : hitKeys) {
+        hits += searchCourse(table, key, found) ? 1 : 0;
+    }
+    result.hitNanoseconds = secondsSince(start) * 1e9 / options.lookups;
+
+    start = chrono::steady_clock::now();
+    for (const string& key : missKeys) {
+        hits += searchCourse(table, key, found) ? 1 : 0;
+    }
+    result.missNanoseconds = secondsSince(start) * 1e9 / options.lookups;
+
+    // Misses with suggestions, as menu option 3 answers them: one character of a real course number
+    // replaced, then the nearest course numbers offered
+    SuggestionIndex suggestionIndex;
+    buildSuggestionIndex(table, suggestionIndex);
+    result.suggestionBytesPerCourse = (double)getSuggestionIndexBytes(suggestionIndex) / courses;
+    result.suggestLookups = max(100LL, min(options.lookups, SUGGESTION_COURSE_BUDGET / courses));
+    vector<string> typoKeys;
+    while ((long long)typoKeys.size() < result.suggestLookups) {
+        string key = courseNumbers[rng() % courseNumbers.size()];
+        key[rng() % key.size()] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[rng() % 36];
+        if (!searchCourse(table, key, found)) {
+            typoKeys.push_back(key);
+        }
+    }
+    vector<string> suggestions;
+    size_t suggested = 0;
+    start = chrono::steady_clock::now();
+    for (const string& key : typoKeys) {
+        if (!searchCourse(table, key, found)) {
+            suggestCourses(suggestionIndex, key, SUGGESTION_COUNT, suggestions);
+            suggested += suggestions.empty() ? 0 : 1;
+        }
+    }
+    result.suggestNanoseconds = secondsSince(start) * 1e9 / result.suggestLookups;
+    suggestionIndex = SuggestionIndex();
+
+    // Name queries: two random name words as an AND, an OR and a quoted phrase
+    NameIndex nameIndex;
+    start = chrono::steady_clock::now();
+    buildNameIndex(table, nameIndex);
+    result.nameBuildSeconds = secondsSince(start);
+    result.nameBytesPerCourse = (double)getNameIndexBytes(nameIndex) / courses;
+
+    result.nameQueries = max(10LL, min(NAME_QUERIES, NAME_QUERY_COURSE_BUDGET / courses));
+    vector<string> nameQueries[3];
+    for (long long i = 0; i < result.nameQueries; i++) {
+        string first = BENCHMARK_NAME_WORDS[rng() % BENCHMARK_NAME_WORD_COUNT];
+        string second = BENCHMARK_NAME_WORDS[rng() % BENCHMARK_NAME_WORD_COUNT];
+        nameQueries[0].push_back(first + " " + second);
+        nameQueries[1].push_back(first + " OR " + second);
+        nameQueries[2].push_back("\"" + first + " " + second + "\"");
+    }
+    double* nameNanos[3] = { &result.nameAndNanos, &result.nameOrNanos, &result.namePhraseNanos };
+    vector<NameMatch> nameMatches;
+    size_t matchTotal = 0;
+    for (int kind = 0; kind < 3; kind++) {
+        start = chrono::steady_clock::now();
+        for (const string& query : nameQueries[kind]) {
+            searchCourseNames(nameIndex, query, nameMatches);
+            matchTotal += nameMatches.size();
+        }
+        *nameNanos[kind] = secondsSince(start) * 1e9 / result.nameQueries;
+    }
+    result.nameMatches = (double)matchTotal / (3 * result.nameQueries);
+    nameIndex = NameIndex();
+
+    // Listing: collect and sort as printAllCoursesSorted does (without printing)
+    start = chrono::steady_clock::now();
+    vector<Course> allCourses = collectAllCourses(table);
+    sortCoursesAlphanumerically(allCourses);
+    result.sortSeconds = secondsSince(start);
+    vector<Course>().swap(allCourses);
+
+    // Storage: bytes per course and a full scan, hash table versus compact catalog
+    result.tableBytesPerCourse = (double)getHashTableBytes(table) / courses;
+    measureHashTableMemory(table, result.memory);
+    CompactCatalog compact;
+    start = chrono::steady_clock::now();
+    buildCompactCatalog(table, compact);
+    result.compactBuildSeconds = secondsSince(start);
+    result.compactBytesPerCourse = (double)getCompactCatalogBytes(compact) / courses;
+
+    size_t tableChecksum = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            tableChecksum += current->course.name.size() + current->course.prerequisites.size()
+                + (unsigned char)current->course.name[0];
+        }
+    }
+    result.tableScanSeconds = secondsSince(start);
+
+    size_t compactChecksum = 0;
+    start = chrono::steady_clock::now();
+    for (size_t id = 0; id < compact.keys.size(); id++) {
+        compactChecksum += compact.nameOffsets[id + 1] - compact.nameOffsets[id]
+            + compact.prerequisiteOffsets[id + 1] - compact.prerequisiteOffsets[id]
+            + (unsigned char)compact.namePool[compact.nameOffsets[id]];
+    }
+    result.compactScanSeconds = secondsSince(start);
+    compact = CompactCatalog();
+    if (tableChecksum != compactChecksum) {
+        restoreOutput(previous);
+        cout << "Error: Compact catalog scan does not match the hash table" << endl;
+        return false;
+    }
+
+    // Resize: one more doubling of the fully loaded table
+    start = chrono::steady_clock::now();
+    resizeHashTable(table);
+    result.resizeSeconds = secondsSince(start);
+
+    cleanupHashTable(table);
+    restoreOutput(previous);
+
+    if (hits != options.lookups) {
+        cout << "Warning: " << hits << " of " << options.lookups << " hit lookups succeeded" << endl;
+    }
+    if ((long long)suggested != result.suggestLookups) {
+        cout << "Warning: " << suggested << " of " << result.suggestLookups << " mistyped lookups got suggestions" << endl;
+    }
+
+    result.peakRssBytes = (long long)getPeakRssBytes();
+    return true;
+}
+
+/**
+ * Function: Run Mixed Workload
+ * Purpose: Runs lookups, upserts and erases from several threads against one sharded table
+ * Input: options - benchmark settings, courseNumbers - keys to use, shards - shard count,
+ *        threads - worker count, result - reference to result to fill
+ */
+void runMixedWorkload(const BenchmarkOptions& options, const vector<string>& courseNumbers, int shards,
+    int threads, MixedResult& result) {
+    ShardedHashTable table;
+    initializeShardedTable(table, shards);
+    for (const string& courseNumber : courseNumbers) {
+        Course course;
+        course.courseNumber = courseNumber;
+        course.name = "Preloaded Course";
+        shardedUpsert(table, course);
+    }
+
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int worker = 0; worker < threads; worker++) {
+        workers.push_back(thread([&options, &courseNumbers, &table, worker]() {
+            mt19937 rng(options.seed + 100 + worker);
+            Course course;
+            course.name = "Updated Course";
+            Course found;
+
+            for (long long op = 0; op < options.mixedOps; op++) {
+                const string& key = courseNumbers[rng() % courseNumbers.size()];
+                unsigned int roll = rng() % 100;
+
+                if ((int)roll < options.readPercent) {
+                    shardedSearch(table, key, found);
+                }
+                else if (roll % 2 == 0) {
+                    course.courseNumber = key;
+                    shardedUpsert(table, course);
+                }
+                else {
+                    shardedErase(table, key);
+                }
+            }
+        }));
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    result.shards = shards;
+    result.threads = threads;
+    result.operations = options.mixedOps * threads;
+    result.seconds = secondsSince(start);
+    cleanupShardedTable(table);
+}
+
+/**
+ * Function: Run Catalog Benchmark
+ * Purpose: Compares loading one catalog file with loading the same rows split across several
+ *          files (row i goes to file i % files, so most prerequisites cross files)
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if both loads succeeded with the same number of courses
+ */
+bool runCatalogBenchmark(const BenchmarkOptions& options, CatalogResult& result) {
+    result = CatalogResult();
+    result.files = options.catalogFiles;
+    result.courses = options.catalogCourses;
+    result.threads = max(1u, thread::hardware_concurrency());
+
+    const string path = "bench_catalog_all.csv";
+    vector<string> courseNumbers;
+    vector<string> lines;
+    if (writeBenchmarkCatalog(path, options.catalogCourses, options.seed, courseNumbers) < 0
+        || !readFileLines(path, lines)) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+
+    vector<string> files;
+    vector<ofstream> outputs(options.catalogFiles);
+    for (int i = 0; i < options.catalogFiles; i++) {
+        files.push_back("bench_catalog_part" + to_string(i) + ".csv");
+        outputs[i].open(files.back(), ios::binary);
+    }
+    for (size_t i = 0; i < lines.size(); i++) {
+        outputs[i % options.catalogFiles] << lines[i] << '\n';
+    }
+    outputs.clear();
+    vector<string>().swap(lines);
+
+    streambuf* previous = silenceOutput();
+
+    // One file: the single-file path of menuOption1
+    HashTable single = initializeHashTable(16);
+    auto start = chrono::steady_clock::now();
+    vector<size_t> lineNumbers;
+    vector<ValidationIssue> issues;
+    bool singleOk = readFileLines(path, lines, &lineNumbers) && validateFileCollectAll(lines, lineNumbers, issues);
+    for (const string& line : lines) {
+        Course course;
+        if (createCourseObject(line, course)) {
+            insertCourseIntoTable(single, course);
+        }
+    }
+    result.singleSeconds = secondsSince(start);
+    vector<string>().swap(lines);
+
+    // Split files: concurrent read, combined validation, parallel merge
+    HashTable multi = initializeHashTable(16);
+    start = chrono::steady_clock::now();
+    bool multiOk = loadCatalogFiles(files, multi);
+    result.multiSeconds = secondsSince(start);
+
+    restoreOutput(previous);
+    bool ok = singleOk && multiOk && single.size == multi.size && single.size == options.catalogCourses;
+    if (!ok) {
+        cout << "Error: Multi-catalog load loaded " << multi.size << " courses, single file " << single.size << endl;
+    }
+
+    cleanupHashTable(single);
+    cleanupHashTable(multi);
+    remove(path.c_str());
+    for (const string& file : files) {
+        remove(file.c_str());
+    }
+    return ok;
+}
+
+/**
+ * Function: Run WAL Benchmark
+ * Purpose: Measures logged edit throughput for group commit sizes 1 to 1024 and compares
+ *          recovery from checkpoint + log with reloading the catalog CSV
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if every step succeeded and recovery rebuilt the same number of courses
+ */
+bool runWalBenchmark(const BenchmarkOptions& options, WalResult& result) {
+    result = WalResult();
+    result.courses = options.walCourses;
+
+    const string csvPath = "bench_catalog_wal.csv";
+    const string logPath = "bench_wal.log";
+    const string checkpointPath = "bench_wal.ckpt";
+    vector<string> courseNumbers;
+    if (writeBenchmarkCatalog(csvPath, options.walCourses, options.seed, courseNumbers) < 0) {
+        cout << "Error: Cannot write '" << csvPath << "'" << endl;
+        return false;
+    }
+
+    streambuf* previous = silenceOutput();
+
+    // Baseline: the single-file load path of menuOption1
+    HashTable table = initializeHashTable(16);
+    vector<string> lines;
+    vector<size_t> lineNumbers;
+    vector<ValidationIssue> issues;
+    auto start = chrono::steady_clock::now();
+    bool loaded = readFileLines(csvPath, lines, &lineNumbers) && validateFileCollectAll(lines, lineNumbers, issues);
+    for (const string& line : lines) {
+        Course course;
+        if (createCourseObject(line, course)) {
+            insertCourseIntoTable(table, course);
+        }
+    }
+    result.csvReloadSeconds = secondsSince(start);
+    vector<string>().swap(lines);
+    remove(csvPath.c_str());
+
+    bool ok = loaded;
+    mt19937 rng(options.seed + 2);
+    for (int batch = 1; ok && batch <= 1024; batch *= 2) {
+        remove(logPath.c_str());
+        remove(checkpointPath.c_str());
+
+        CourseLog log;
+        log.groupCommitSize = batch;
+        log.compactMinBytes = 1ULL << 62; // Measure appends only
+        start = chrono::steady_clock::now();
+        ok = openCourseLog(log, table, logPath, checkpointPath);
+        if (batch == 1) {
+            result.checkpointSeconds = secondsSince(start);
+        }
+        size_t checkpointSyncs = log.syncCount;
+
+        WalRun run;
+        run.batch = batch;
+        run.edits = options.walEdits;
+        Course course;
+        start = chrono::steady_clock::now();
+        for (long long i = 0; ok && i < options.walEdits; i++) {
+            searchCourse(table, courseNumbers[rng() % courseNumbers.size()], course);
+            course.name = "Updated Course " + to_string(i);
+            ok = updateCourse(log, table, course);
+        }
+        ok = ok && commitCourseLog(log, table);
+        run.seconds = secondsSince(start);
+        run.syncs = log.syncCount - checkpointSyncs;
+        closeCourseLog(log, table);
+        result.runs.push_back(run);
+    }
+
+    // Recovery of the last run: checkpoint of the table plus walEdits logged updates
+    HashTable recovered = initializeHashTable(16);
+    CourseLog recoveredLog;
+    CourseRecoveryStats stats;
+    ok = ok && recoverCourseLog(recoveredLog, recovered, stats, logPath, checkpointPath);
+    result.recoverySeconds = stats.seconds;
+    ok = ok && recovered.size == table.size && stats.logEdits == (size_t)options.walEdits;
+    closeCourseLog(recoveredLog, recovered);
+
+    restoreOutput(previous);
+    if (!ok) {
+        cout << "Error: Edit log benchmark failed (recovered " << recovered.size << " of " << table.size
+            << " courses, " << stats.logEdits << " edits)" << endl;
+    }
+
+    cleanupHashTable(table);
+    cleanupHashTable(recovered);
+    remove(logPath.c_str());
+    remove(checkpointPath.c_str());
+    return ok;
+}
+
+/**
+ * Function: Run History Benchmark
+ * Purpose: Records a catalog over several terms with a small share of courses changing each
+ *          term, then compares the history's memory with keeping one full table per term
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if every term was recorded and the as-of lookups found every course
+ */
+bool runHistoryBenchmark(const BenchmarkOptions& options, HistoryResult& result) {
+    result = HistoryResult();
+    result.courses = options.historyCourses;
+    result.terms = options.historyTerms;
+    result.changePercent = options.historyChangePercent;
+
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    mt19937 rng(options.seed + 3);
+    vector<string> courseNumbers;
+    for (long long id = 0; id < options.historyCourses; id++) {
+        Course course;
+        course.courseNumber = benchmarkCourseNumber(id);
+        course.name = "Course " + to_string(id);
+        int prerequisites = id == 0 ? 0 : (int)(rng() % 3);
+        for (int p = 0; p < prerequisites; p++) {
+            course.prerequisites.push_back(courseNumbers[rng() % id]);
+        }
+        courseNumbers.push_back(course.courseNumber);
+        insertCourseIntoTable(table, course);
+    }
+
+    CatalogHistory history;
+    int firstTerm = 2024 * 4 + 3; // Fall 2024, then one term per step
+    long long changes = options.historyCourses * options.historyChangePercent / 100;
+    bool ok = true;
+    for (int t = 0; ok && t < options.historyTerms; t++) {
+        // Rename a few courses in place; every other course is unchanged
+        for (long long c = 0; t > 0 && c < changes; c++) {
+            Course course;
+            searchCourse(table, courseNumbers[rng() % courseNumbers.size()], course);
+            course.name = "Course revised in term " + to_string(t);
+            insertCourseIntoTable(table, course);
+        }
+
+        TermChanges termChanges;
+        auto start = chrono::steady_clock::now();
+        ok = recordCatalogTerm(history, table, firstTerm + t, termChanges);
+        result.recordSeconds += secondsSince(start);
+    }
+    if (options.historyTerms > 0) {
+        result.recordSeconds /= options.historyTerms;
+    }
+    result.records = history.records;
+    result.historyBytes = getCatalogHistoryBytes(history);
+    result.snapshotBytes = getHashTableBytes(table) * (size_t)options.historyTerms;
+
+    // As-of lookups spread over every recorded term
+    long long lookups = min(options.lookups, options.historyCourses * 4);
+    size_t found = 0;
+    auto start = chrono::steady_clock::now();
+    for (long long i = 0; i < lookups; i++) {
+        Course course;
+        found += searchCourse(history, courseNumbers[rng() % courseNumbers.size()],
+            firstTerm + (int)(rng() % options.historyTerms), course) ? 1 : 0;
+    }
+    result.asOfNanos = lookups > 0 ? secondsSince(start) * 1e9 / lookups : 0.0;
+
+    cleanupHashTable(table);
+    if (!ok || found != (size_t)lookups) {
+        cout << "Error: Catalog history benchmark failed (" << found << " of " << lookups << " as-of lookups found)" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Run Stream Benchmark
+ * Purpose: Loads the same catalog with the phased loader (whole file as lines, then validate,
+ *          then insert) and with the streaming pipeline, comparing time and buffered file bytes
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if both loads succeeded with the same number of courses
+ */
+bool runStreamBenchmark(const BenchmarkOptions& options, StreamResult& result) {
+    result = StreamResult();
+    result.courses = options.streamCourses;
+
+    const string path = "bench_catalog_stream.csv";
+    vector<string> courseNumbers;
+    result.fileBytes = writeBenchmarkCatalog(path, options.streamCourses, options.seed, courseNumbers);
+    if (result.fileBytes < 0) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+    vector<string>().swap(courseNumbers);
+
+    streambuf* previous = silenceOutput();
+
+    // Phased: every line is held as a string until the insert step ends
+    HashTable phased = initializeHashTable(16);
+    phased.verbose = false;
+    auto start = chrono::steady_clock::now();
+    {
+        vector<string> lines;
+        vector<size_t> lineNumbers;
+        vector<ValidationIssue> issues;
+        bool ok = readFileLines(path, lines, &lineNumbers) && validateFileCollectAll(lines, lineNumbers, issues);
+        for (size_t i = 0; ok && i < lines.size(); i++) {
+            Course course;
+            if (createCourseObject(lines[i], course)) {
+                insertCourseIntoTable(phased, course);
+            }
+        }
+        result.lineBytes = lines.capacity() * sizeof(string) + lineNumbers.capacity() * sizeof(size_t);
+        for (const string& line : lines) {
+            result.lineBytes += getStringHeapBytes(line);
+        }
+    }
+    result.phasedSeconds = secondsSince(start);
+
+    // Streamed: read, parse and insert overlap; only a few blocks are in memory
+    HashTable streamed = initializeHashTable(16);
+    streamed.verbose = false;
+    vector<ValidationIssue> issues;
+    StreamLoadStats stats;
+    start = chrono::steady_clock::now();
+    bool valid = streamCatalogFile(path, streamed, issues, stats);
+    result.streamedSeconds = secondsSince(start);
+    result.bufferedBytes = stats.peakBufferedBytes;
+    result.readerWaits = stats.readerWaits;
+    result.parserWaits = stats.parserWaits;
+
+    restoreOutput(previous);
+    bool ok = valid && phased.size == options.streamCourses && streamed.size == phased.size;
+    if (!ok) {
+        cout << "Error: Streamed load failed (" << streamed.size << " of " << phased.size << " courses, "
+            << issues.size() << " issues)" << endl;
+    }
+    cleanupHashTable(phased);
+    cleanupHashTable(streamed);
+    remove(path.c_str());
+    return ok;
+}
+
+/**
+ * Function: Run Columnar Benchmark
+ * Purpose: Times columnar export and projected imports against plain buffer writes and reads of
+ *          the same size (the file stays in the page cache, so "disk" here is the OS file path)
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if export and every import succeeded and the full import matched
+ */
+bool runColumnarBenchmark(const BenchmarkOptions& options, ColumnarResult& result) {
+    result = ColumnarResult();
+    result.courses = options.columnarCourses;
+
+    const string csvPath = "bench_catalog_columnar.csv";
+    const string path = "bench_columnar.ptcc";
+    vector<string> courseNumbers;
+    if (writeBenchmarkCatalog(csvPath, options.columnarCourses, options.seed, courseNumbers) < 0) {
+        cout << "Error: Cannot write '" << csvPath << "'" << endl;
+        return false;
+    }
+    vector<string>().swap(courseNumbers);
+
+    streambuf* previous = silenceOutput();
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    vector<ValidationIssue> issues;
+    StreamLoadStats stats;
+    CompactCatalog catalog;
+    bool ok = streamCatalogFile(csvPath, table, issues, stats) && buildCompactCatalog(table, catalog);
+    cleanupHashTable(table);
+    remove(csvPath.c_str());
+
+    auto start = chrono::steady_clock::now();
+    ok = ok && exportColumnarCatalog(catalog, path, result.fileBytes);
+    result.exportSeconds = secondsSince(start);
+
+    // Reference: the same bytes through one write and one read
+    vector<unsigned char> raw;
+    start = chrono::steady_clock::now();
+    ok = ok && readBinaryFile(path, raw) && raw.size() == result.fileBytes;
+    result.rawReadSeconds = secondsSince(start);
+    const string rawPath = "bench_columnar_raw.ptcc";
+    start = chrono::steady_clock::now();
+    {
+        ofstream file(rawPath, ios::binary | ios::trunc);
+        file.write((const char*)raw.data(), raw.size());
+    }
+    result.rawWriteSeconds = secondsSince(start);
+    remove(rawPath.c_str());
+    vector<unsigned char>().swap(raw);
+
+    const char* names[] = { "all", "keys", "names", "prerequisites" };
+    const unsigned int projections[] = { PROJECT_ALL, PROJECT_KEYS, PROJECT_NAMES, PROJECT_PREREQUISITES };
+    for (int i = 0; ok && i < 4; i++) {
+        ColumnarRead read;
+        read.projection = names[i];
+        CompactCatalog imported;
+        start = chrono::steady_clock::now();
+        ok = importColumnarCatalog(path, projections[i], imported, read.bytesRead);
+        read.seconds = secondsSince(start);
+        if (ok && projections[i] == PROJECT_ALL) {
+            ok = imported.namePool == catalog.namePool && imported.prerequisites == catalog.prerequisites
+                && imported.keys.size() == catalog.keys.size()
+                && memcmp(imported.keys.data(), catalog.keys.data(), catalog.keys.size() * sizeof(PackedKey)) == 0;
+        }
+        result.reads.push_back(read);
+    }
+
+    restoreOutput(previous);
+    remove(path.c_str());
+    if (!ok) {
+        cout << "Error: Columnar export benchmark failed" << endl;
+    }
+    return ok;
+}
+
+/**
+ * Function: Run Dependency Benchmark
+ * Purpose: Builds a layered prerequisite DAG the way ProjectTwoCatalogGenerator does (courses split
+ *          evenly across levels in id order, 0-3 prerequisites, the first from the level directly
+ *          below so chains reach full depth) and times the dependency index on it
+ * Input: options - benchmark settings, result - reference to result to fill
+ * Output: true if every lookup found its course
+ */
+bool runDependencyBenchmark(const BenchmarkOptions& options, DependencyResult& result) {
+    result = DependencyResult();
+    result.courses = options.dagCourses;
+    result.depth = max(1, options.dagDepth);
+    long long courses = options.dagCourses;
+    long long depth = result.depth;
+
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    mt19937 rng(options.seed + 5);
+    vector<string> courseNumbers;
+    courseNumbers.reserve((size_t)courses);
+    for (long long id = 0; id < courses; id++) {
+        courseNumbers.push_back(benchmarkCourseNumber(id));
+    }
+    for (long long id = 0; id < courses; id++) {
+        Course course;
+        course.courseNumber = courseNumbers[(size_t)id];
+        course.name = "Course " + to_string(id);
+
+        // First id of level L is ceil(L * courses / depth)
+        long long level = id * depth / courses;
+        long long previousLevelStart = ((level - 1) * courses + depth - 1) / depth;
+        long long previousLevelEnd = (level * courses + depth - 1) / depth;
+        int fanIn = level == 0 || previousLevelEnd <= previousLevelStart ? 0 : (int)(rng() % 4);
+        for (int p = 0; p < fanIn; p++) {
+            long long low = p == 0 ? previousLevelStart : 0;
+            const string& prerequisite = courseNumbers[(size_t)(low + (long long)(rng() % (previousLevelEnd - low)))];
+            if (find(course.prerequisites.begin(), course.prerequisites.end(), prerequisite) == course.prerequisites.end()) {
+                course.prerequisites.push_back(prerequisite);
+            }
+        }
+        result.edges += course.prerequisites.size();
+        insertCourseIntoTable(table, course);
+    }
+
+    DependencyIndex index;
+    auto start = chrono::steady_clock::now();
+    buildDependencyIndex(table, index);
+    result.buildSeconds = secondsSince(start);
+    cleanupHashTable(table);
+
+    // Direct dependents of random courses
+    vector<string> keys;
+    for (long long i = 0; i < options.lookups; i++) {
+        keys.push_back(courseNumbers[rng() % courseNumbers.size()]);
+    }
+    vector<string> dependents;
+    long long found = 0;
+    start = chrono::steady_clock::now();
+    for (const string& key : keys) {
+        found += getDirectDependents(index, key, dependents) ? 1 : 0;
+    }
+    result.directNanos = secondsSince(start) * 1e9 / options.lookups;
+
+    // Impact sets of courses spread evenly over every level: first with an empty cache, then again
+    result.impactQueries = (int)min<long long>(DAG_IMPACT_QUERIES, courses);
+    vector<string> impactKeys;
+    for (int i = 0; i < result.impactQueries; i++) {
+        impactKeys.push_back(courseNumbers[(size_t)(i * courses / result.impactQueries)]);
+    }
+    vector<string> impacted;
+    size_t impactTotal = 0;
+    start = chrono::steady_clock::now();
+    for (const string& key : impactKeys) {
+        found += getImpactSet(index, key, impacted) ? 1 : 0;
+        impactTotal += impacted.size();
+    }
+    result.coldImpactNanos = secondsSince(start) * 1e9 / result.impactQueries;
+    start = chrono::steady_clock::now();
+    for (const string& key : impactKeys) {
+        found += getImpactSet(index, key, impacted) ? 1 : 0;
+    }
+    result.memoImpactNanos = secondsSince(start) * 1e9 / result.impactQueries;
+    result.impactSize = (double)impactTotal / result.impactQueries;
+
+    if (found != options.lookups + 2LL * result.impactQueries) {
+        cout << "Error: Dependency benchmark failed (" << found << " lookups found)" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Print Benchmark Row
+ * Purpose: Prints one human-readable result row
+ * Input: result - measurements for one catalog size
+ */
+void printBenchmarkRow(const BenchmarkResult& result) {
+    double megabytes = result.fileBytes / (1024.0 * 1024.0);
+
+    cout << setw(9) << result.courses
+        << fixed << setprecision(1)
+        << setw(10) << (result.readSeconds > 0 ? megabytes / result.readSeconds : 0.0)
+        << setw(10) << (result.insertSeconds > 0 ? megabytes / result.insertSeconds : 0.0);
+    cout << setw(12) << setprecision(4) << result.validateSeconds;
+    if (result.legacyValidateSeconds >= 0) {
+        cout << setw(12) << setprecision(4) << result.legacyValidateSeconds;
+    }
+    else {
+        cout << setw(12) << "skipped";
+    }
+    cout << setprecision(1)
+        << setw(9) << result.hitNanoseconds
+        << setw(9) << result.missNanoseconds
+        << setw(11) << result.suggestNanoseconds
+        << setw(8) << result.suggestionBytesPerCourse
+        << setw(6) << result.resizeCount
+        << setw(11) << setprecision(4) << result.resizeSeconds
+        << setw(10) << result.sortSeconds
+        << setw(9) << setprecision(1) << result.tableBytesPerCourse
+        << setw(9) << result.compactBytesPerCourse
+        << setw(10) << setprecision(3) << result.tableScanSeconds * 1000.0
+        << setw(10) << result.compactScanSeconds * 1000.0
+        << setw(10) << setprecision(1) << result.peakRssBytes / (1024.0 * 1024.0) << endl;
+}
+
+/**
+ * Function: Write Benchmark JSON
+ * Purpose: Writes all results in a machine-readable form for comparing builds
+ * Input: options - benchmark settings, results - measurements for every size,
+ *        mixedResults - concurrent workload measurements, catalogResult - multi-catalog load measurements,
+ *        walResult - edit log measurements, historyResult - catalog history measurements,
+ *        streamResult - phased versus streamed load measurements, columnarResult - columnar export measurements,
+ *        dependencyResult - dependency index measurements
+ * Output: true if the file was written
+ */
+bool writeBenchmarkJson(const BenchmarkOptions& options, const vector<BenchmarkResult>& results,
+    const vector<MixedResult>& mixedResults, const CatalogResult& catalogResult, const WalResult& walResult,
+    const HistoryResult& historyResult, const StreamResult& streamResult, const ColumnarResult& columnarResult,
+    const DependencyResult& dependencyResult) {
+    ofstream file(options.jsonPath);
+    if (!file.is_open()) {
+        cout << "Error: Cannot write '" << options.jsonPath << "'" << endl;
+        return false;
+    }
+
+    string compiler = "unknown";
+#if defined(_MSC_VER)
+    compiler = "msvc " + to_string(_MSC_VER);
+#elif defined(__clang__)
+    compiler = "clang " __clang_version__;
+#elif defined(__GNUC__)
+    compiler = "gcc " __VERSION__;
+#endif
+
+    file << "{\n";
+    file << "  \"label\": \"" << options.label << "\",\n";
+    file << "  \"compiler\": \"" << compiler << "\",\n";
+    file << "  \"seed\": " << options.seed << ",\n";
+    file << "  \"lookups\": " << options.lookups << ",\n";
+    file << "  \"results\": [\n";
+
+    file << setprecision(9);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        file << "    {\"courses\": " << r.courses
+            << ", \"file_bytes\": " << r.fileBytes
+            << ", \"read_seconds\": " << r.readSeconds
+            << ", \"read_mb_per_second\": " << (r.readSeconds > 0 ? r.fileBytes / (1024.0 * 1024.0) / r.readSeconds : 0.0)
+            << ", \"validate_seconds\": " << r.validateSeconds
+            << ", \"legacy_validate_seconds\": ";
+        if (r.legacyValidateSeconds >= 0) {
+            file << r.legacyValidateSeconds;
+        }
+        else {
+            file << "null";
+        }
+        file << ", \"insert_seconds\": " << r.insertSeconds
+            << ", \"load_mb_per_second\": " << (r.insertSeconds > 0 ? r.fileBytes / (1024.0 * 1024.0) / r.insertSeconds : 0.0)
+            << ", \"resize_count\": " << r.resizeCount
+            << ", \"resize_seconds\": " << r.resizeSeconds
+            << ", \"hit_ns_per_op\": " << r.hitNanoseconds
+            << ", \"miss_ns_per_op\": " << r.missNanoseconds
+            << ", \"suggest_lookups\": " << r.suggestLookups
+            << ", \"miss_suggest_ns_per_op\": " << r.suggestNanoseconds
+            << ", \"suggestion_index_bytes_per_course\": " << r.suggestionBytesPerCourse
+            << ", \"sort_seconds\": " << r.sortSeconds
+            << ", \"name_build_seconds\": " << r.nameBuildSeconds
+            << ", \"name_queries\": " << r.nameQueries
+            << ", \"name_and_ns_per_op\": " << r.nameAndNanos
+            << ", \"name_or_ns_per_op\": " << r.nameOrNanos
+            << ", \"name_phrase_ns_per_op\": " << r.namePhraseNanos
+            << ", \"name_mean_matches\": " << r.nameMatches
+            << ", \"name_index_bytes_per_course\": " << r.nameBytesPerCourse
+            << ", \"table_bytes_per_course\": " << r.tableBytesPerCourse
+            << ", \"compact_bytes_per_course\": " << r.compactBytesPerCourse
+            << ", \"compact_build_seconds\": " << r.compactBuildSeconds
+            << ", \"table_scan_seconds\": " << r.tableScanSeconds
+            << ", \"compact_scan_seconds\": " << r.compactScanSeconds
+            << ", \"peak_rss_bytes\": " << r.peakRssBytes
+            << ", \"peak_rss_per_size\": " << (r.peakPerSize ? "true" : "false")
+            << ", \"rss_growth_bytes\": " << r.rssGrowthBytes
+            << ", \"memory\": ";
+        writeTableMemoryJson(file, r.memory);
+        file << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    file << "  ],\n";
+
+    file << "  \"mixed\": {\"courses\": " << options.mixedCourses << ", \"read_percent\": " << options.readPercent
+        << ", \"runs\": [\n";
+    for (size_t i = 0; i < mixedResults.size(); i++) {
+        const MixedResult& m = mixedResults[i];
+        file << "    {\"shards\": " << m.shards
+            << ", \"threads\": " << m.threads
+            << ", \"operations\": " << m.operations
+            << ", \"seconds\": " << m.seconds
+            << ", \"mops_per_second\": " << (m.seconds > 0 ? m.operations / m.seconds / 1e6 : 0.0)
+            << "}" << (i + 1 < mixedResults.size() ? "," : "") << "\n";
+    }
+    file << "  ]},\n";
+
+    file << "  \"catalogs\": {\"files\": " << catalogResult.files
+        << ", \"courses\": " << catalogResult.courses
+        << ", \"threads\": " << catalogResult.threads
+        << ", \"single_file_seconds\": " << catalogResult.singleSeconds
+        << ", \"multi_file_seconds\": " << catalogResult.multiSeconds << "},\n";
+
+    file << "  \"wal\": {\"courses\": " << walResult.courses
+        << ", \"checkpoint_seconds\": " << walResult.checkpointSeconds
+        << ", \"recovery_seconds\": " << walResult.recoverySeconds
+        << ", \"csv_reload_seconds\": " << walResult.csvReloadSeconds << ", \"runs\": [\n";
+    for (size_t i = 0; i < walResult.runs.size(); i++) {
+        const WalRun& run = walResult.runs[i];
+        file << "    {\"batch\": " << run.batch
+            << ", \"edits\": " << run.edits
+            << ", \"seconds\": " << run.seconds
+            << ", \"syncs\": " << run.syncs
+            << ", \"edits_per_second\": " << (run.seconds > 0 ? run.edits / run.seconds : 0.0)
+            << "}" << (i + 1 < walResult.runs.size() ? "," : "") << "\n";
+    }
+    file << "  ]},\n";
+
+    file << "  \"history\": {\"courses\": " << historyResult.courses
+        << ", \"terms\": " << historyResult.terms
+        << ", \"change_percent\": " << historyResult.changePercent
+        << ", \"records\": " << historyResult.records
+        << ", \"history_bytes\": " << historyResult.historyBytes
+        << ", \"snapshot_bytes\": " << historyResult.snapshotBytes
+        << ", \"record_seconds\": " << historyResult.recordSeconds
+        << ", \"as_of_ns\": " << historyResult.asOfNanos << "},\n";
+
+    file << "  \"stream\": {\"courses\": " << streamResult.courses
+        << ", \"file_bytes\": " << streamResult.fileBytes
+        << ", \"phased_seconds\": " << streamResult.phasedSeconds
+        << ", \"phased_line_bytes\": " << streamResult.lineBytes
+        << ", \"streamed_seconds\": " << streamResult.streamedSeconds
+        << ", \"streamed_buffered_bytes\": " << streamResult.bufferedBytes
+        << ", \"reader_waits\": " << streamResult.readerWaits
+        << ", \"parser_waits\": " << streamResult.parserWaits << "},\n";
+
+    file << "  \"columnar\": {\"courses\": " << columnarResult.courses
+        << ", \"file_bytes\": " << columnarResult.fileBytes
+        << ", \"export_seconds\": " << columnarResult.exportSeconds
+        << ", \"raw_write_seconds\": " << columnarResult.rawWriteSeconds
+        << ", \"raw_read_seconds\": " << columnarResult.rawReadSeconds << ", \"imports\": [\n";
+    for (size_t i = 0; i < columnarResult.reads.size(); i++) {
+        const ColumnarRead& read = columnarResult.reads[i];
+        file << "    {\"projection\": \"" << read.projection << "\""
+            << ", \"bytes_read\": " << read.bytesRead
+            << ", \"seconds\": " << read.seconds
+            << "}" << (i + 1 < columnarResult.reads.size() ? "," : "") << "\n";
+    }
+    file << "  ]},\n";
+
+    file << "  \"dependencies\": {\"courses\": " << dependencyResult.courses
+        << ", \"depth\": " << dependencyResult.depth
+        << ", \"edges\": " << dependencyResult.edges
+        << ", \"build_seconds\": " << dependencyResult.buildSeconds
+        << ", \"direct_ns_per_op\": " << dependencyResult.directNanos
+        << ", \"impact_queries\": " << dependencyResult.impactQueries
+        << ", \"impact_mean_courses\": " << dependencyResult.impactSize
+        << ", \"impact_cold_ns_per_op\": " << dependencyResult.coldImpactNanos
+        << ", \"impact_memoized_ns_per_op\": " << dependencyResult.memoImpactNanos << "}\n";
+    file << "}\n";
+    return true;
+}
+
+/**
+ * Function: Parse Benchmark Options
+ * Purpose: Reads command line flags into benchmark settings
+ * Input: argc, argv - command line, options - reference to settings to fill
+ * Output: true if every flag was recognized
+ */
+bool parseBenchmarkOptions(int argc, char* argv[], BenchmarkOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        string flag = argv[i];
+        if (i + 1 >= argc) {
+            cout << "Error: Missing value for '" << flag << "'" << endl;
+            return false;
+        }
+        string value = argv[++i];
+
+        if (flag == "--max-size") {
+            options.maxSize = atoll(value.c_str());
+        }
+        else if (flag == "--validate-max") {
+            options.validateMax = atoll(value.c_str());
+        }
+        else if (flag == "--lookups") {
+            options.lookups = max(1LL, atoll(value.c_str()));
+        }
+        else if (flag == "--mixed-courses") {
+            options.mixedCourses = max(1LL, atoll(value.c_str()));
+        }
+        else if (flag == "--mixed-ops") {
+            options.mixedOps = atoll(value.c_str());
+        }
+        else if (flag == "--mixed-threads") {
+            options.mixedMaxThreads = atoi(value.c_str());
+        }
+        else if (flag == "--read-percent") {
+            options.readPercent = atoi(value.c_str());
+        }
+        else if (flag == "--catalog-files") {
+            options.catalogFiles = max(0, atoi(value.c_str()));
+        }
+        else if (flag == "--catalog-courses") {
+            options.catalogCourses = max(1LL, atoll(value.c_str()));
+        }
+        else if (flag == "--wal-courses") {
+            options.walCourses = max(1LL, atoll(value.c_str()));
+        }
+        else if (flag == "--wal-edits") {
+            options.walEdits = max(0LL, atoll(value.c_str()));
+        }
+        else if (flag == "--history-courses") {
+            options.historyCourses = max(1LL, atoll(value.c_str()));
+        }
+        else if (flag == "--history-terms") {
+            options.historyTerms = max(0, atoi(value.c_str()));
+        }
+        else if (flag == "--history-change-percent") {
+            options.historyChangePercent = min(100, max(0, atoi(value.c_str())));
+        }
+        else if (flag == "--stream-courses") {
+            options.streamCourses = max(0LL, atoll(value.c_str()));
+        }
+        else if (flag == "--columnar-courses") {
+            options.columnarCourses = max(0LL, atoll(value.c_str()));
+        }
+        else if (flag == "--dag-courses") {
+            options.dagCourses = max(0LL, atoll(value.c_str()));
+        }
+        else if (flag == "--dag-depth") {
+            options.dagDepth = max(1, atoi(value.c_str()));
+        }
+        else if (flag == "--seed") {
+            options.seed = (unsigned int)strtoul(value.c_str(), nullptr, 10);
+        }
+        else if (flag == "--label") {
+            options.label = value;
+        }
+        else if (flag == "--json") {
+            options.jsonPath = value;
+        }
+        else {
+            cout << "Error: Unknown option '" << flag << "'" << endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    if (!parseBenchmarkOptions(argc, argv, options)) {
+        cout << "Usage: ProjectTwoBenchmark [--max-size N] [--validate-max N] [--lookups N]"
+            << " [--mixed-courses N] [--mixed-ops N] [--mixed-threads N] [--read-percent N]"
+            << " [--catalog-files N] [--catalog-courses N] [--wal-courses N] [--wal-edits N]"
+            << " [--history-courses N] [--history-terms N] [--history-change-percent N]"
+            << " [--stream-courses N] [--columnar-courses N] [--dag-courses N] [--dag-depth N]"
+            << " [--seed N] [--label TEXT] [--json FILE]" << endl;
+        return 1;
+    }
+
+    cout << "ABCU Course Management System - Benchmark (" << options.label << ")" << endl;
+    cout << "Peak RSS is per size where the OS can reset it (Linux), else cumulative (sizes run smallest first)."
+        << endl << endl;
+    cout << setw(9) << "courses" << setw(10) << "read MB/s" << setw(10) << "load MB/s"
+        << setw(12) << "validate s" << setw(12) << "legacy val s" << setw(9) << "hit ns" << setw(9) << "miss ns"
+        << setw(11) << "suggest ns" << setw(8) << "sug B/c"
+        << setw(6) << "rsz" << setw(11) << "resize s" << setw(10) << "sort s"
+        << setw(9) << "tbl B/c" << setw(9) << "soa B/c" << setw(10) << "tbl scan" << setw(10) << "soa scan"
+        << setw(10) << "peak MB" << endl;
+
+    vector<BenchmarkResult> results;
+    for (long long courses = 10; courses <= options.maxSize; courses *= 10) {
+        BenchmarkResult result;
+        if (!runBenchmarkSize(options, courses, result)) {
+            return 1;
+        }
+        printBenchmarkRow(result);
+        results.push_back(result);
+    }
+
+    // Where each course's bytes go as the catalog grows, against what the process really grew by
+    cout << endl << "Hash table memory per course (bytes; unused = string and prerequisite capacity past size,"
+        << " alloc = estimated allocator overhead)" << endl;
+    cout << setw(9) << "courses" << setw(9) << "buckets" << setw(8) << "nodes" << setw(10) << "str heap"
+        << setw(9) << "prereq" << setw(9) << "unused" << setw(8) << "alloc" << setw(9) << "total"
+        << setw(11) << "rss growth" << setw(9) << "inline%" << endl;
+    for (const BenchmarkResult& result : results) {
+        const TableMemory& memory = result.memory;
+        double perCourse = 1.0 / max<long long>(1, result.courses);
+        cout << setw(9) << result.courses << fixed << setprecision(1)
+            << setw(9) << memory.bucketBytes * perCourse
+            << setw(8) << memory.nodeBytes * perCourse
+            << setw(10) << memory.heapStringBytes * perCourse
+            << setw(9) << memory.prerequisiteBytes * perCourse
+            << setw(9) << (memory.heapStringUnusedBytes + memory.prerequisiteSlackBytes) * perCourse
+            << setw(8) << memory.allocatorBytes * perCourse
+            << setw(9) << getTableMemoryTotal(memory, true) * perCourse
+            << setw(11) << result.rssGrowthBytes * perCourse
+            << setw(9) << (memory.strings > 0 ? memory.inlineStrings * 100.0 / memory.strings : 0.0) << endl;
+    }
+
+    // Course name search: ranked queries per kind and index size as the catalog grows
+    cout << endl << "Name queries (two name words each, run as AND, OR and a quoted phrase)" << endl;
+    cout << setw(9) << "courses" << setw(9) << "queries" << setw(11) << "build ms" << setw(11) << "AND us" << setw(11) << "OR us"
+        << setw(11) << "phrase us" << setw(11) << "matches" << setw(9) << "idx B/c" << endl;
+    for (const BenchmarkResult& result : results) {
+        cout << setw(9) << result.courses << setw(9) << result.nameQueries << fixed << setprecision(2)
+            << setw(11) << result.nameBuildSeconds * 1000.0
+            << setw(11) << result.nameAndNanos / 1000.0
+            << setw(11) << result.nameOrNanos / 1000.0
+            << setw(11) << result.namePhraseNanos / 1000.0
+            << setw(11) << setprecision(1) << result.nameMatches
+            << setw(9) << result.nameBytesPerCourse << endl;
+    }
+
+    // Concurrent mixed workload: one global lock (1 shard) versus the default sharding
+    vector<MixedResult> mixedResults;
+    if (options.mixedOps > 0 && options.mixedMaxThreads > 0) {
+        cout << endl << "Mixed workload: " << options.mixedCourses << " courses, " << options.readPercent
+            << "% lookups, rest upsert/erase, " << options.mixedOps << " ops per thread" << endl;
+        cout << setw(8) << "shards" << setw(9) << "threads" << setw(12) << "Mops/s" << setw(12) << "ns/op" << endl;
+
+        vector<string> courseNumbers;
+        for (long long id = 0; id < options.mixedCourses; id++) {
+            courseNumbers.push_back(benchmarkCourseNumber(id));
+        }
+
+        int shardCounts[2] = { 1, DEFAULT_SHARD_COUNT };
+        for (int shards : shardCounts) {
+            for (int threads = 1; threads <= options.mixedMaxThreads; threads *= 2) {
+                MixedResult mixed;
+                runMixedWorkload(options, courseNumbers, shards, threads, mixed);
+                mixedResults.push_back(mixed);
+
+                double opsPerSecond = mixed.seconds > 0 ? mixed.operations / mixed.seconds : 0.0;
+                cout << setw(8) << shards << setw(9) << threads << fixed << setprecision(2)
+                    << setw(12) << opsPerSecond / 1e6
+                    << setw(12) << setprecision(1) << (opsPerSecond > 0 ? 1e9 / opsPerSecond : 0.0) << endl;
+            }
+        }
+    }
+
+    // One catalog split across department files, loaded concurrently
+    CatalogResult catalogResult;
+    if (options.catalogFiles > 0) {
+        if (!runCatalogBenchmark(options, catalogResult)) {
+            return 1;
+        }
+        cout << endl << "Multi-catalog load: " << catalogResult.courses << " courses in " << catalogResult.files
+            << " files, " << catalogResult.threads << " thread(s)" << endl;
+        cout << fixed << setprecision(3) << "  one file: " << catalogResult.singleSeconds << " s, split files: "
+            << catalogResult.multiSeconds << " s" << endl;
+    }
+
+    // Durable edits: group commit sizes 1..1024, then recovery versus a CSV reload
+    WalResult walResult;
+    if (options.walEdits > 0) {
+        if (!runWalBenchmark(options, walResult)) {
+            return 1;
+        }
+        cout << endl << "Edit log: " << options.walEdits << " updates on " << walResult.courses << " courses" << endl;
+        cout << setw(8) << "batch" << setw(10) << "fsyncs" << setw(14) << "edits/s" << endl;
+        for (const WalRun& run : walResult.runs) {
+            cout << setw(8) << run.batch << setw(10) << run.syncs << setw(14) << fixed << setprecision(0)
+                << (run.seconds > 0 ? run.edits / run.seconds : 0.0) << endl;
+        }
+        cout << setprecision(3) << "  checkpoint: " << walResult.checkpointSeconds << " s, recovery (checkpoint + log): "
+            << walResult.recoverySeconds << " s, CSV reload: " << walResult.csvReloadSeconds << " s" << endl;
+    }
+
+    // Catalog history: memory of shared records versus one full table per term
+    HistoryResult historyResult;
+    if (options.historyTerms > 0) {
+        if (!runHistoryBenchmark(options, historyResult)) {
+            return 1;
+        }
+        cout << endl << "Catalog history: " << historyResult.terms << " terms of " << historyResult.courses
+            << " courses, " << historyResult.changePercent << "% renamed per term" << endl;
+        cout << "  records: " << historyResult.records << ", history: " << historyResult.historyBytes
+            << " bytes, one table per term: " << historyResult.snapshotBytes << " bytes" << endl;
+        cout << setprecision(3) << "  record term: " << historyResult.recordSeconds * 1000.0 << " ms, as-of lookup: "
+            << setprecision(0) << historyResult.asOfNanos << " ns" << endl;
+    }
+
+    // Single-file load: phased versus streaming pipeline
+    StreamResult streamResult;
+    if (options.streamCourses > 0) {
+        if (!runStreamBenchmark(options, streamResult)) {
+            return 1;
+        }
+        cout << endl << "Single-file load of " << streamResult.courses << " courses (" << formatByteCount(streamResult.fileBytes)
+            << ")" << endl;
+        cout << setprecision(3) << "  phased:   " << streamResult.phasedSeconds << " s, lines held: "
+            << formatByteCount(streamResult.lineBytes) << endl;
+        cout << "  streamed: " << streamResult.streamedSeconds << " s, file bytes buffered: "
+            << formatByteCount(streamResult.bufferedBytes) << " (reader held back " << streamResult.readerWaits
+            << "x, parser " << streamResult.parserWaits << "x)" << endl;
+    }
+
+    // Columnar export: export and projected imports against plain buffer I/O of the same size
+    ColumnarResult columnarResult;
+    if (options.columnarCourses > 0) {
+        if (!runColumnarBenchmark(options, columnarResult)) {
+            return 1;
+        }
+        double megabytes = columnarResult.fileBytes / 1048576.0;
+        cout << endl << "Columnar export of " << columnarResult.courses << " courses ("
+            << formatByteCount(columnarResult.fileBytes) << ")" << endl;
+        cout << setprecision(0) << "  export: " << megabytes / columnarResult.exportSeconds << " MB/s (plain write "
+            << megabytes / columnarResult.rawWriteSeconds << " MB/s), plain read " << megabytes / columnarResult.rawReadSeconds
+            << " MB/s" << endl;
+        for (const ColumnarRead& read : columnarResult.reads) {
+            cout << "  import " << left << setw(14) << read.projection << right << setw(12) << formatByteCount(read.bytesRead)
+                << setprecision(1) << setw(10) << read.seconds * 1000.0 << " ms" << setprecision(0) << setw(8)
+                << read.bytesRead / 1048576.0 / read.seconds << " MB/s" << endl;
+        }
+    }
+
+    // Dependency index on a layered prerequisite DAG
+    DependencyResult dependencyResult;
+    if (options.dagCourses > 0) {
+        if (!runDependencyBenchmark(options, dependencyResult)) {
+            return 1;
+        }
+        cout << endl << "Dependency index: " << dependencyResult.courses << " courses, " << dependencyResult.depth
+            << " levels, " << dependencyResult.edges << " prerequisite edges" << endl;
+        cout << setprecision(3) << "  build: " << dependencyResult.buildSeconds * 1000.0 << " ms, direct dependents: "
+            << setprecision(0) << dependencyResult.directNanos << " ns" << endl;
+        cout << "  impact set (" << dependencyResult.impactQueries << " courses, " << setprecision(1)
+            << dependencyResult.impactSize << " courses each on average): cold " << dependencyResult.coldImpactNanos / 1000.0
+            << " us, memoized " << dependencyResult.memoImpactNanos / 1000.0 << " us" << endl;
+    }
+
+    if (!writeBenchmarkJson(options, results, mixedResults, catalogResult, walResult, historyResult, streamResult,
+        columnarResult, dependencyResult)) {
+        return 1;
+    }
+
+    cout << endl << "Results written to " << options.jsonPath << endl;
+    return 0;
+}
@@ -0,0 +1,484 @@
+/**
+ * ABCU Course Management System - Synthetic Catalog Generator
+ *
+ * Writes course catalogs in the exact CSV format parseLine accepts
+ * (CourseNumber,CourseName,Prerequisite1,...) with a controllable shape:
+ * size, department mix, name length, prerequisite fan-in/fan-out and DAG
+ * depth, plus optional hash-collision keys and deliberate defects
+ * (malformed rows, duplicates, dangling prerequisites and cycles).
+ *
+ * Output depends only on the options and the seed: mt19937_64 is fully
+ * specified by the standard and all sampling is done with plain modulo
+ * arithmetic, so every platform produces byte-identical files.
+ */
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+/**
+ * Generator settings taken from the command line
+ */
+struct GeneratorOptions {
+    long long courses = 1000;                // Number of distinct valid courses
+    unsigned int seed = 1;                   // Random seed (same seed = same file)
+    string departments = "CSCI:40,MATH:25,PHYS:15,CHEM:10,ENGL:10"; // PREFIX:weight,...
+    int minNameWords = 2;                    // Shortest course name in words
+    int maxNameWords = 5;                    // Longest course name in words
+    int minFanIn = 0;                        // Fewest prerequisites per course (above level 0)
+    int maxFanIn = 3;                        // Most prerequisites per course
+    int maxFanOut = 0;                       // Most courses that may require one course (0 = unlimited)
+    int depth = 8;                           // Number of DAG levels (longest prerequisite chain)
+    double collisionFraction = 0.0;          // Fraction of course numbers sharing one hashFunction value
+    long long malformedRows = 0;             // Rows that fail parseLine/validateLineFormat
+    long long duplicateRows = 0;             // Extra rows reusing an existing course number
+    long long danglingPrerequisites = 0;     // Prerequisites naming courses that do not exist
+    long long cycles = 0;                    // Back edges that close a prerequisite cycle
+    bool shuffle = true;                     // Shuffle row order (false = level order)
+    string outputPath = "";                  // Output file (empty = standard output)
+};
+
+/**
+ * A course as generated, before defects are written out
+ */
+struct GeneratedCourse {
+    string courseNumber;          // Unique course number
+    string name;                  // Course name (never contains commas)
+    int level = 0;                // DAG level (prerequisites come from lower levels)
+    vector<long long> prerequisites; // Prerequisite course ids
+    vector<string> extraPrerequisites; // Dangling or cycle-closing prerequisites
+};
+
+/**
+ * Department prefix with its sampling weight
+ */
+struct DepartmentWeight {
+    string prefix;    // Course number prefix (e.g. "CSCI")
+    int weight = 1;   // Relative share of courses
+    int nextNumber = 100; // Next course number to assign in this department
+};
+
+/**
+ * Function: Random Below
+ * Purpose: Draws a value in [0, bound) with portable, deterministic arithmetic
+ * Input: rng - generator, bound - exclusive upper bound (must be > 0)
+ * Output: Random value
+ */
+unsigned long long randomBelow(mt19937_64& rng, unsigned long long bound) {
+    return rng() % bound;
+}
+
+/**
+ * Function: Random Between
+ * Purpose: Draws a value in [low, high]
+ * Input: rng - generator, low, high - inclusive bounds
+ * Output: Random value (low if high < low)
+ */
+long long randomBetween(mt19937_64& rng, long long low, long long high) {
+    if (high <= low) {
+        return low;
+    }
+    return low + (long long)randomBelow(rng, (unsigned long long)(high - low + 1));
+}
+
+/**
+ * Function: Parse Departments
+ * Purpose: Parses "PREFIX:weight,PREFIX:weight" into department weights
+ * Input: spec - department specification, departments - reference to vector to fill
+ * Output: true if at least one department with a positive weight was parsed
+ */
+bool parseDepartments(const string& spec, vector<DepartmentWeight>& departments) {
+    departments.clear();
+    size_t start = 0;
+
+    while (start <= spec.size()) {
+        size_t end = spec.find(',', start);
+        if (end == string::npos) {
+            end = spec.size();
+        }
+
+        string entry = spec.substr(start, end - start);
+        if (!entry.empty()) {
+            DepartmentWeight department;
+            size_t colon = entry.find(':');
+            department.prefix = entry.substr(0, colon);
+            department.weight = colon == string::npos ? 1 : atoi(entry.substr(colon + 1).c_str());
+            if (department.prefix.empty() || department.weight <= 0) {
+                return false;
+            }
+            departments.push_back(department);
+        }
+
+        start = end + 1;
+    }
+
+    return !departments.empty();
+}
+
+/**
+ * Function: Parse Range
+ * Purpose: Parses "MIN-MAX" or a single number into an inclusive range
+ * Input: text - range text, low, high - references that receive the bounds
+ * Output: true if the range is valid
+ */
+bool parseRange(const string& text, int& low, int& high) {
+    size_t dash = text.find('-');
+    low = atoi(text.substr(0, dash).c_str());
+    high = dash == string::npos ? low : atoi(text.substr(dash + 1).c_str());
+    return low >= 0 && high >= low;
+}
+
+/**
+ * Function: Colliding Course Number
+ * Purpose: Builds a course number whose hashFunction value is shared by every
+ *          other number built with the same prefix and block count.
+ *          With base 31, the two-character blocks "dU" and "(d+1)(U-31)" add the
+ *          same amount to the polynomial hash (e.g. "0O" and "10"), so choosing
+ *          either block at each position yields 2^blocks colliding keys that
+ *          survive toupper and collide at every table capacity.
+ * Input: prefix - department prefix, id - which key to build, blocks - number of blocks
+ * Output: Course number such as "HASH0O100O"
+ */
+string collidingCourseNumber(const string& prefix, unsigned long long id, int blocks) {
+    string courseNumber = prefix;
+    for (int b = 0; b < blocks; b++) {
+        courseNumber += ((id >> b) & 1) ? "10" : "0O";
+    }
+    return courseNumber;
+}
+
+/**
+ * Function: Generate Courses
+ * Purpose: Creates the valid part of the catalog as a layered DAG
+ * Input: options - generator settings, departments - department weights,
+ *        rng - generator, courses - reference to vector that receives the courses
+ */
+void generateCourses(const GeneratorOptions& options, vector<DepartmentWeight>& departments,
+    mt19937_64& rng, vector<GeneratedCourse>& courses) {
+    static const char* words[] = { "Introduction", "to", "Data", "Structures", "Algorithms", "Advanced",
+        "Theory", "Programming", "Systems", "Design", "Analysis", "Applied", "Methods", "Seminar",
+        "Laboratory", "Discrete", "Mathematics", "Operating", "Networks", "Software", "Engineering",
+        "Computer", "Science", "Statistics", "Physics", "Chemistry", "Writing", "Research", "Topics", "in" };
+    const int wordCount = sizeof(words) / sizeof(words[0]);
+
+    int totalWeight = 0;
+    for (const DepartmentWeight& department : departments) {
+        totalWeight += department.weight;
+    }
+
+    long long collidingCourses = (long long)(options.collisionFraction * options.courses);
+    int collisionBlocks = 1;
+    while ((1LL << collisionBlocks) < collidingCourses) {
+        collisionBlocks++;
+    }
+
+    courses.assign((size_t)options.courses, GeneratedCourse());
+    vector<int> dependentCounts((size_t)options.courses, 0);
+    int depth = options.depth < 1 ? 1 : options.depth;
+
+    for (long long id = 0; id < options.courses; id++) {
+        GeneratedCourse& course = courses[(size_t)id];
+
+        // Course number: colliding keys first, then weighted departments
+        if (id < collidingCourses) {
+            course.courseNumber = collidingCourseNumber("HASH", (unsigned long long)id, collisionBlocks);
+        }
+        else {
+            int pick = (int)randomBelow(rng, (unsigned long long)totalWeight);
+            size_t d = 0;
+            while (pick >= departments[d].weight) {
+                pick -= departments[d].weight;
+                d++;
+            }
+            course.courseNumber = departments[d].prefix + to_string(departments[d].nextNumber++);
+        }
+
+        // Name
+        long long nameWords = randomBetween(rng, options.minNameWords, options.maxNameWords);
+        for (long long w = 0; w < nameWords; w++) {
+            if (w > 0) {
+                course.name += ' ';
+            }
+            course.name += words[randomBelow(rng, wordCount)];
+        }
+        if (course.name.empty()) {
+            course.name = "Untitled";
+        }
+
+        // Level: courses are split evenly across levels in id order
+        course.level = (int)(id * depth / options.courses);
+        if (course.level == 0) {
+            continue;
+        }
+
+        // First id of level L is ceil(L * courses / depth)
+        long long previousLevelStart = ((course.level - 1) * options.courses + depth - 1) / depth;
+        long long previousLevelEnd = (course.level * options.courses + depth - 1) / depth;
+        if (previousLevelEnd <= previousLevelStart) {
+            continue;
+        }
+
+        // Prerequisites: the first one comes from the level directly below so chains reach full depth
+        long long fanIn = randomBetween(rng, options.minFanIn, options.maxFanIn);
+
+        for (long long p = 0; p < fanIn; p++) {
+            long long low = p == 0 ? previousLevelStart : 0;
+            long long high = previousLevelEnd - 1;
+
+            // A few attempts to find a prerequisite that still has fan-out capacity
+            for (int attempt = 0; attempt < 8; attempt++) {
+                long long candidate = randomBetween(rng, low, high);
+                bool repeated = false;
+                for (long long existing : course.prerequisites) {
+                    repeated = repeated || existing == candidate;
+                }
+                if (repeated || (options.maxFanOut > 0 && dependentCounts[(size_t)candidate] >= options.maxFanOut)) {
+                    continue;
+                }
+
+                course.prerequisites.push_back(candidate);
+                dependentCounts[(size_t)candidate]++;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Function: Inject Defects
+ * Purpose: Adds dangling prerequisites and cycle-closing back edges
+ * Input: options - generator settings, rng - generator, courses - courses to modify
+ * Output: Number of cycles actually created (needs courses with prerequisites)
+ */
+long long injectDefects(const GeneratorOptions& options, mt19937_64& rng, vector<GeneratedCourse>& courses) {
+    for (long long i = 0; i < options.danglingPrerequisites; i++) {
+        GeneratedCourse& course = courses[(size_t)randomBelow(rng, courses.size())];
+        course.extraPrerequisites.push_back("NONE" + to_string(900000 + i));
+    }
+
+    // A cycle: course C requires P, so make P require C as well
+    long long created = 0;
+    for (long long attempt = 0; created < options.cycles && attempt < options.cycles * 16; attempt++) {
+        GeneratedCourse& dependent = courses[(size_t)randomBelow(rng, courses.size())];
+        if (dependent.prerequisites.empty()) {
+            continue;
+        }
+        long long prerequisite = dependent.prerequisites[(size_t)randomBelow(rng, dependent.prerequisites.size())];
+        courses[(size_t)prerequisite].extraPrerequisites.push_back(dependent.courseNumber);
+        created++;
+    }
+
+    return created;
+}
+
+/**
+ * Function: Write Catalog
+ * Purpose: Writes courses, duplicates and malformed rows as CSV
+ * Input: options - generator settings, rng - generator, courses - generated courses, out - output stream
+ * Output: Number of rows written
+ */
+long long writeCatalog(const GeneratorOptions& options, mt19937_64& rng,
+    const vector<GeneratedCourse>& courses, ostream& out) {
+    // Row kinds: >= 0 course id, -1 duplicate, -2 malformed
+    vector<long long> rows;
+    rows.reserve(courses.size() + (size_t)(options.duplicateRows + options.malformedRows));
+    for (long long id = 0; id < (long long)courses.size(); id++) {
+        rows.push_back(id);
+    }
+    for (long long i = 0; i < options.duplicateRows; i++) {
+        rows.push_back(-1);
+    }
+    for (long long i = 0; i < options.malformedRows; i++) {
+        rows.push_back(-2);
+    }
+
+    // Fisher-Yates with the portable sampler
+    if (options.shuffle) {
+        for (size_t i = rows.size(); i > 1; i--) {
+            size_t j = (size_t)randomBelow(rng, i);
+            swap(rows[i - 1], rows[j]);
+        }
+    }
+
+    string line;
+    for (long long row : rows) {
+        line.clear();
+
+        if (row >= 0) {
+            const GeneratedCourse& course = courses[(size_t)row];
+            line = course.courseNumber + "," + course.name;
+            for (long long prerequisite : course.prerequisites) {
+                line += "," + courses[(size_t)prerequisite].courseNumber;
+            }
+            for (const string& prerequisite : course.extraPrerequisites) {
+                line += "," + prerequisite;
+            }
+        }
+        else if (row == -1) {
+            const GeneratedCourse& original = courses[(size_t)randomBelow(rng, courses.size())];
+            line = original.courseNumber + ",Duplicate of " + original.name;
+        }
+        else {
+            // Alternate between a row with no name and a row with no fields at all
+            if (randomBelow(rng, 2) == 0) {
+                line = courses[(size_t)randomBelow(rng, courses.size())].courseNumber;
+            }
+            else {
+                line = ", ,";
+            }
+        }
+
+        out << line << '\n';
+    }
+
+    return (long long)rows.size();
+}
+
+/**
+ * Function: Print Generator Usage
+ * Purpose: Lists the command line options
+ */
+void printGeneratorUsage() {
+    cerr << "Usage: ProjectTwoCatalogGenerator [options]\n"
+        << "  --courses N            distinct valid courses (default 1000)\n"
+        << "  --seed N               random seed; same options + seed = same file (default 1)\n"
+        << "  --departments SPEC     prefix weights, e.g. CSCI:40,MATH:25 (default 5 departments)\n"
+        << "  --name-words MIN-MAX   words per course name (default 2-5)\n"
+        << "  --fan-in MIN-MAX       prerequisites per course above level 0 (default 0-3)\n"
+        << "  --fan-out N            most dependents per course, 0 = unlimited (default 0)\n"
+        << "  --depth N              DAG levels / longest prerequisite chain (default 8)\n"
+        << "  --collisions F         fraction of course numbers with identical hashFunction values\n"
+        << "  --malformed N          rows that fail parsing or format validation\n"
+        << "  --duplicates N         extra rows reusing existing course numbers\n"
+        << "  --dangling N           prerequisites that name nonexistent courses\n"
+        << "  --cycles N             back edges closing prerequisite cycles\n"
+        << "  --no-shuffle           keep rows in level order\n"
+        << "  --output FILE          write to FILE instead of standard output\n";
+}
+
+/**
+ * Function: Parse Generator Options
+ * Purpose: Reads command line flags into generator settings
+ * Input: argc, argv - command line, options - reference to settings to fill
+ * Output: true if every flag was recognized and valid
+ */
+bool parseGeneratorOptions(int argc, char* argv[], GeneratorOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        string flag = argv[i];
+
+        if (flag == "--help") {
+            return false;
+        }
+        if (flag == "--no-shuffle") {
+            options.shuffle = false;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            cerr << "Error: Missing value for '" << flag << "'" << endl;
+            return false;
+        }
+        string value = argv[++i];
+
+        if (flag == "--courses") {
+            options.courses = atoll(value.c_str());
+        }
+        else if (flag == "--seed") {
+            options.seed = (unsigned int)strtoul(value.c_str(), nullptr, 10);
+        }
+        else if (flag == "--departments") {
+            options.departments = value;
+        }
+        else if (flag == "--name-words") {
+            if (!parseRange(value, options.minNameWords, options.maxNameWords)) {
+                cerr << "Error: Invalid range '" << value << "'" << endl;
+                return false;
+            }
+        }
+        else if (flag == "--fan-in") {
+            if (!parseRange(value, options.minFanIn, options.maxFanIn)) {
+                cerr << "Error: Invalid range '" << value << "'" << endl;
+                return false;
+            }
+        }
+        else if (flag == "--fan-out") {
+            options.maxFanOut = atoi(value.c_str());
+        }
+        else if (flag == "--depth") {
+            options.depth = atoi(value.c_str());
+        }
+        else if (flag == "--collisions") {
+            options.collisionFraction = atof(value.c_str());
+        }
+        else if (flag == "--malformed") {
+            options.malformedRows = atoll(value.c_str());
+        }
+        else if (flag == "--duplicates") {
+            options.duplicateRows = atoll(value.c_str());
+        }
+        else if (flag == "--dangling") {
+            options.danglingPrerequisites = atoll(value.c_str());
+        }
+        else if (flag == "--cycles") {
+            options.cycles = atoll(value.c_str());
+        }
+        else if (flag == "--output") {
+            options.outputPath = value;
+        }
+        else {
+            cerr << "Error: Unknown option '" << flag << "'" << endl;
+            return false;
+        }
+    }
+
+    if (options.courses < 1) {
+        cerr << "Error: --courses must be at least 1" << endl;
+        return false;
+    }
+    if (options.collisionFraction < 0.0 || options.collisionFraction > 1.0) {
+        cerr << "Error: --collisions must be between 0 and 1" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    GeneratorOptions options;
+    if (!parseGeneratorOptions(argc, argv, options)) {
+        printGeneratorUsage();
+        return 1;
+    }
+
+    vector<DepartmentWeight> departments;
+    if (!parseDepartments(options.departments, departments)) {
+        cerr << "Error: Invalid department list '" << options.departments << "'" << endl;
+        return 1;
+    }
+
+    mt19937_64 rng(options.seed);
+    vector<GeneratedCourse> courses;
+    generateCourses(options, departments, rng, courses);
+    long long cycles = injectDefects(options, rng, courses);
+
+    ofstream file;
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath, ios::binary);
+        if (!file.is_open()) {
+            cerr << "Error: Cannot write '" << options.outputPath << "'" << endl;
+            return 1;
+        }
+    }
+    ostream& out = options.outputPath.empty() ? cout : file;
+
+    long long rows = writeCatalog(options, rng, courses, out);
+
+    cerr << "Generated " << rows << " rows: " << options.courses << " courses, "
+        << options.duplicateRows << " duplicates, " << options.malformedRows << " malformed, "
+        << options.danglingPrerequisites << " dangling prerequisites, " << cycles << " cycles" << endl;
+    return 0;
+}
@@ -0,0 +1,267 @@
+/**
+ * ABCU Course Management System - Embedded Catalog Generator
+ *
+ * Turns a catalog CSV into EmbeddedCatalog.h: constexpr arrays of course
+ * records in course number order, flat prerequisite id lists and a minimal
+ * perfect-hash index (hash and displace). A program built with
+ * PROJECTTWO_EMBEDDED_CATALOG answers course lookups from these tables with
+ * no file parsing at startup and no heap allocation.
+ *
+ * The CSV goes through the same reader, validator and parser as menu option 1,
+ * so a file the planner would reject is rejected here too.
+ *
+ * Usage: ProjectTwoEmbedGenerator --input catalog.csv --output EmbeddedCatalog.h
+ */
+#define PROJECTTWO_NO_MAIN
+#include "ProjectTwo.cpp"
+
+#include <cstdlib>
+
+const unsigned int EMBED_KEYS_PER_BUCKET = 4;     // Average courses per perfect-hash bucket
+const unsigned int EMBED_MAX_SEED = 1u << 24;     // Seeds tried per bucket before the slot table grows
+
+/**
+ * Function: Build Perfect Hash
+ * Purpose: Finds a seed per bucket so every course lands in its own slot
+ * Input: keys - course numbers (course id = index), bucketCount, slotCount - table sizes,
+ *        seeds, slots - references to vectors receiving the index
+ * Output: true if every bucket found a seed
+ */
+bool buildPerfectHash(const vector<string>& keys, unsigned int bucketCount, unsigned int slotCount,
+    vector<unsigned int>& seeds, vector<unsigned int>& slots) {
+    vector<vector<unsigned int>> buckets(bucketCount);
+    for (unsigned int id = 0; id < keys.size(); id++) {
+        buckets[embeddedCatalogHash(0, keys[id].data(), keys[id].size()) % bucketCount].push_back(id);
+    }
+
+    // Place the largest buckets first while most slots are still free
+    vector<unsigned int> order(bucketCount);
+    for (unsigned int b = 0; b < bucketCount; b++) {
+        order[b] = b;
+    }
+    stable_sort(order.begin(), order.end(), [&buckets](unsigned int a, unsigned int b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    seeds.assign(bucketCount, 0);
+    slots.assign(slotCount, EMBEDDED_EMPTY_SLOT);
+    vector<unsigned int> candidate;
+
+    for (unsigned int bucket : order) {
+        const vector<unsigned int>& members = buckets[bucket];
+        if (members.empty()) {
+            break;
+        }
+
+        bool placed = false;
+        for (unsigned int seed = 1; seed < EMBED_MAX_SEED && !placed; seed++) {
+            candidate.clear();
+            placed = true;
+            for (unsigned int id : members) {
+                unsigned int slot = embeddedCatalogHash(seed, keys[id].data(), keys[id].size()) % slotCount;
+                if (slots[slot] != EMBEDDED_EMPTY_SLOT || find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+                    placed = false;
+                    break;
+                }
+                candidate.push_back(slot);
+            }
+
+            if (placed) {
+                seeds[bucket] = seed;
+                for (size_t i = 0; i < members.size(); i++) {
+                    slots[candidate[i]] = members[i];
+                }
+            }
+        }
+
+        if (!placed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Function: C++ String Literal
+ * Purpose: Quotes text for a C++ source file (escapes quotes, backslashes, '?' and non-printable bytes)
+ * Input: text - raw text
+ * Output: Quoted literal
+ */
+string cppStringLiteral(const string& text) {
+    string literal = "\"";
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\' || c == '?') {
+            literal += '\\';
+            literal += (char)c;
+        }
+        else if (c < 32 || c >= 127) {
+            char octal[8];
+            snprintf(octal, sizeof(octal), "\\%03o", c);
+            literal += octal;
+        }
+        else {
+            literal += (char)c;
+        }
+    }
+    return literal + "\"";
+}
+
+/**
+ * Function: Write Number Array
+ * Purpose: Writes a constexpr unsigned int array, 16 values per line
+ * Input: out - output stream, name - array name, values - contents (an empty array gets one 0)
+ */
+void writeNumberArray(ostream& out, const string& name, const vector<unsigned int>& values) {
+    out << "constexpr unsigned int " << name << "[" << max<size_t>(1, values.size()) << "] = {";
+    for (size_t i = 0; i < values.size(); i++) {
+        out << (i % 16 == 0 ? "\n    " : " ");
+        if (values[i] == EMBEDDED_EMPTY_SLOT) {
+            out << "EMBEDDED_EMPTY_SLOT";
+        }
+        else {
+            out << values[i];
+        }
+        out << (i + 1 < values.size() ? "," : "");
+    }
+    out << (values.empty() ? " 0 };\n" : "\n};\n");
+}
+
+/**
+ * Function: Print Embed Usage
+ * Purpose: Prints the command-line options
+ */
+void printEmbedUsage() {
+    cerr << "Usage: ProjectTwoEmbedGenerator --input catalog.csv --output EmbeddedCatalog.h" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    string inputPath;
+    string outputPath;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string flag = argv[i];
+        if (flag == "--input") {
+            inputPath = argv[i + 1];
+        }
+        else if (flag == "--output") {
+            outputPath = argv[i + 1];
+        }
+        else {
+            printEmbedUsage();
+            return 1;
+        }
+    }
+    if (inputPath.empty() || outputPath.empty() || argc % 2 == 0) {
+        printEmbedUsage();
+        return 1;
+    }
+
+    // Same read and validation as menu option 1; messages go to the console
+    vector<string> lines;
+    vector<size_t> lineNumbers;
+    if (!readFileLines(inputPath, lines, &lineNumbers)) {
+        return 1;
+    }
+    vector<ValidationIssue> issues;
+    if (!validateFileCollectAll(lines, lineNumbers, issues)) {
+        printValidationIssues(issues, 50);
+        cerr << "Error: '" << inputPath << "' is not a valid catalog" << endl;
+        return 1;
+    }
+
+    // Later rows replace earlier duplicates, exactly as the hash table does on load
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    for (const string& line : lines) {
+        Course course;
+        if (createCourseObject(line, course)) {
+            insertCourseIntoTable(table, course);
+        }
+    }
+    vector<Course> courses = collectAllCourses(table);
+    cleanupHashTable(table);
+    sort(courses.begin(), courses.end(), [](const Course& a, const Course& b) {
+        return a.courseNumber < b.courseNumber;
+    });
+
+    vector<string> keys;
+    unordered_map<string, unsigned int> ids;
+    for (const Course& course : courses) {
+        ids[course.courseNumber] = (unsigned int)keys.size();
+        keys.push_back(course.courseNumber);
+    }
+
+    vector<unsigned int> prerequisites;
+    vector<unsigned int> firstPrerequisite;
+    for (const Course& course : courses) {
+        firstPrerequisite.push_back((unsigned int)prerequisites.size());
+        for (const string& prerequisite : course.prerequisites) {
+            prerequisites.push_back(ids[prerequisite]);
+        }
+    }
+
+    // Minimal perfect hash when possible; grow the slot table by 10% until every bucket fits
+    unsigned int bucketCount = max(1u, (unsigned int)(keys.size() / EMBED_KEYS_PER_BUCKET));
+    unsigned int slotCount = (unsigned int)keys.size();
+    vector<unsigned int> seeds;
+    vector<unsigned int> slots;
+    while (!buildPerfectHash(keys, bucketCount, slotCount, seeds, slots)) {
+        slotCount += slotCount / 10 + 1;
+    }
+
+    // Self-check: every course must be found in its own slot
+    for (unsigned int id = 0; id < keys.size(); id++) {
+        unsigned int bucket = embeddedCatalogHash(0, keys[id].data(), keys[id].size()) % bucketCount;
+        unsigned int slot = embeddedCatalogHash(seeds[bucket], keys[id].data(), keys[id].size()) % slotCount;
+        if (slots[slot] != id) {
+            cerr << "Error: Perfect hash check failed for '" << keys[id] << "'" << endl;
+            return 1;
+        }
+    }
+
+    ofstream out(outputPath, ios::binary);
+    if (!out.is_open()) {
+        cerr << "Error: Cannot write '" << outputPath << "'" << endl;
+        return 1;
+    }
+
+    size_t slash = inputPath.find_last_of("/\\");
+    string source = slash == string::npos ? inputPath : inputPath.substr(slash + 1);
+
+    out << "/**\n"
+        << " * Built-in course catalog generated by ProjectTwoEmbedGenerator from " << source << "\n"
+        << " * Do not edit; regenerate from the CSV. Included by ProjectTwo.cpp when\n"
+        << " * PROJECTTWO_EMBEDDED_CATALOG is defined (EmbeddedCourse is declared there).\n"
+        << " */\n"
+        << "#pragma once\n\n";
+    out << "const char* const EMBEDDED_CATALOG_SOURCE = " << cppStringLiteral(source) << ";\n";
+    out << "constexpr unsigned int EMBEDDED_COURSE_COUNT = " << courses.size() << ";\n\n";
+
+    out << "// Courses in course number order: number, name, first prerequisite, prerequisite count\n";
+    out << "constexpr EmbeddedCourse EMBEDDED_COURSES[" << courses.size() << "] = {\n";
+    for (size_t id = 0; id < courses.size(); id++) {
+        out << "    { " << cppStringLiteral(courses[id].courseNumber) << ", " << cppStringLiteral(courses[id].name)
+            << ", " << firstPrerequisite[id] << ", " << courses[id].prerequisites.size() << " }"
+            << (id + 1 < courses.size() ? "," : "") << "\n";
+    }
+    out << "};\n\n";
+
+    out << "// Prerequisite course ids, grouped by course\n";
+    writeNumberArray(out, "EMBEDDED_PREREQUISITES", prerequisites);
+    out << "\n";
+
+    out << "// Perfect-hash index: bucket = embeddedCatalogHash(0, key) % EMBEDDED_BUCKET_COUNT,\n"
+        << "// slot = embeddedCatalogHash(EMBEDDED_SEEDS[bucket], key) % EMBEDDED_SLOT_COUNT\n";
+    out << "constexpr unsigned int EMBEDDED_BUCKET_COUNT = " << bucketCount << ";\n";
+    writeNumberArray(out, "EMBEDDED_SEEDS", seeds);
+    out << "constexpr unsigned int EMBEDDED_SLOT_COUNT = " << slotCount << ";\n";
+    writeNumberArray(out, "EMBEDDED_SLOTS", slots);
+
+    if (!out.good()) {
+        cerr << "Error: Failed writing '" << outputPath << "'" << endl;
+        return 1;
+    }
+
+    cerr << "Embedded " << courses.size() << " courses and " << prerequisites.size() << " prerequisites from "
+        << source << " (" << bucketCount << " buckets, " << slotCount << " slots)" << endl;
+    return 0;
+}
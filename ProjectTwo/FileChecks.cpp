@@ -0,0 +1,282 @@
+/**
+ * ABCU Course Management System - File Handling Checks
+ *
+ * Regression checks for the files ProjectTwo.cpp reads back: the course edit log,
+ * its checkpoint and the columnar export. Each check builds its files in the working directory, runs
+ * the real recovery or commit code on them and removes them again. Registered
+ * with CTest; exits non-zero if any check fails.
+ *
+ * Usage: ProjectTwoFileChecks
+ */
+#define PROJECTTWO_NO_MAIN
+#include "ProjectTwo.cpp"
+
+#include <cstdio>
+
+const char* const CHECK_LOG_PATH = "check_edits.log";             // Edit log used by the checks
+const char* const CHECK_CHECKPOINT_PATH = "check_checkpoint.bin"; // Checkpoint used by the checks
+const char* const CHECK_COLUMNAR_PATH = "check_export.ptcc";      // Columnar export used by the checks
+
+/**
+ * Function: Remove Check Files
+ * Purpose: Deletes every file a check may have left behind
+ */
+void removeCheckFiles() {
+    const string paths[] = { CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH, string(CHECK_CHECKPOINT_PATH) + ".tmp",
+        string(CHECK_LOG_PATH) + ".damaged", string(CHECK_CHECKPOINT_PATH) + ".damaged", CHECK_COLUMNAR_PATH };
+    for (const string& path : paths) {
+        remove(path.c_str());
+    }
+}
+
+/**
+ * Function: Make Course
+ * Purpose: Builds a course with no prerequisites
+ * Input: courseNumber - course number, name - course name
+ * Output: Course
+ */
+Course makeCourse(const string& courseNumber, const string& name) {
+    Course course;
+    course.courseNumber = courseNumber;
+    course.name = name;
+    return course;
+}
+
+/**
+ * Function: Write Check File
+ * Purpose: Replaces a file with the given bytes
+ * Input: path - file to write, bytes - contents
+ * Output: true if written
+ */
+bool writeCheckFile(const string& path, const vector<unsigned char>& bytes) {
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write((const char*)bytes.data(), bytes.size());
+    return file.good();
+}
+
+/**
+ * Function: Check Oversized Checkpoint Count
+ * Purpose: A checkpoint header claiming more courses than the file can hold must be reported as
+ *          damaged without sizing the table from it, and the files must then be set aside
+ * Output: true if the check passed
+ */
+bool checkOversizedCheckpointCount() {
+    removeCheckFiles();
+    vector<unsigned char> bytes(COURSE_CHECKPOINT_MAGIC, COURSE_CHECKPOINT_MAGIC + 4);
+    appendLittleEndian(bytes, COURSE_CHECKPOINT_VERSION, 4);
+    appendLittleEndian(bytes, 0, 8);
+    appendLittleEndian(bytes, 1ULL << 40, 8);
+    if (!writeCheckFile(CHECK_CHECKPOINT_PATH, bytes)) {
+        return false;
+    }
+
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    CourseLog log;
+    CourseRecoveryStats stats;
+    bool recovered = recoverCourseLog(log, table, stats, CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH);
+    bool passed = !recovered && table.capacity == 16 && table.size == 0;
+
+    // The unreadable checkpoint is kept aside and editing stays off
+    passed = setAsideCourseLog(log) && passed && log.editingDisabled && !fileExists(CHECK_CHECKPOINT_PATH)
+        && fileExists(string(CHECK_CHECKPOINT_PATH) + ".damaged");
+    cleanupHashTable(table);
+    return passed;
+}
+
+/**
+ * Function: Check Failed Commit Rollback
+ * Purpose: When the group commit cannot be written, every buffered edit must be undone in the
+ *          table and logging turned off (the log is redirected to /dev/full)
+ * Output: true if the check passed (or /dev/full does not exist)
+ */
+bool checkFailedCommitRollback() {
+#ifdef _WIN32
+    cout << "(skipped: no /dev/full) ";
+    return true;
+#else
+    int full = open("/dev/full", O_WRONLY);
+    if (full < 0) {
+        cout << "(skipped: no /dev/full) ";
+        return true;
+    }
+
+    removeCheckFiles();
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    insertCourseIntoTable(table, makeCourse("CSCI100", "Old Name"));
+    CourseLog log;
+    log.groupCommitSize = 8;
+    if (!openCourseLog(log, table, CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH)) {
+        close(full);
+        return false;
+    }
+    unsigned long long nextSequence = log.nextSequence;
+    dup2(full, log.fd);
+    close(full);
+
+    // Four buffered edits, then the commit that fails
+    bool buffered = updateCourse(log, table, makeCourse("CSCI100", "New Name"))
+        && addCourse(log, table, makeCourse("CSCI200", "Added"))
+        && removeCourse(log, table, "CSCI200")
+        && addCourse(log, table, makeCourse("CSCI300", "Added"));
+    bool committed = commitCourseLog(log, table);
+
+    const Course* course = findCourseInTable(table, "CSCI100");
+    bool passed = buffered && !committed && table.size == 1 && course != nullptr && course->name == "Old Name"
+        && findCourseInTable(table, "CSCI200") == nullptr && findCourseInTable(table, "CSCI300") == nullptr
+        && log.nextSequence == nextSequence && log.pendingRecords == 0 && log.fd < 0;
+    closeCourseLog(log, table);
+    cleanupHashTable(table);
+    return passed;
+#endif
+}
+
+/**
+ * Function: Check Crash After Checkpoint Rename
+ * Purpose: A crash after a new checkpoint is renamed into place but before the log is truncated
+ *          must recover the new checkpoint and skip the old log records it already contains
+ * Output: true if the check passed
+ */
+bool checkCrashAfterCheckpointRename() {
+    removeCheckFiles();
+
+    // Session 1: three logged edits on top of a one-course checkpoint
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    insertCourseIntoTable(table, makeCourse("CSCI100", "First"));
+    CourseLog log;
+    bool passed = openCourseLog(log, table, CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH);
+    for (int i = 0; i < 3 && passed; i++) {
+        passed = addCourse(log, table, makeCourse("CSCI20" + to_string(i), "Logged"));
+    }
+    passed = passed && commitCourseLog(log, table);
+    closeCourseLog(log, table);
+    cleanupHashTable(table);
+
+    vector<unsigned char> oldLog;
+    passed = passed && readBinaryFile(CHECK_LOG_PATH, oldLog) && !oldLog.empty();
+
+    // Session 2: a different table becomes the checkpoint; then put the old log back as if the
+    // truncate after the rename never happened
+    HashTable replacement = initializeHashTable(16);
+    replacement.verbose = false;
+    insertCourseIntoTable(replacement, makeCourse("MATH100", "Replacement"));
+    CourseLog replacementLog;
+    passed = passed && openCourseLog(replacementLog, replacement, CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH);
+    closeCourseLog(replacementLog, replacement);
+    cleanupHashTable(replacement);
+    passed = passed && writeCheckFile(CHECK_LOG_PATH, oldLog);
+
+    HashTable recovered = initializeHashTable(16);
+    recovered.verbose = false;
+    CourseLog recoveredLog;
+    CourseRecoveryStats stats;
+    passed = passed && recoverCourseLog(recoveredLog, recovered, stats, CHECK_LOG_PATH, CHECK_CHECKPOINT_PATH)
+        && recovered.size == 1 && findCourseInTable(recovered, "MATH100") != nullptr
+        && stats.skippedEdits == 3 && stats.logEdits == 0;
+    closeCourseLog(recoveredLog, recovered);
+    cleanupHashTable(recovered);
+    return passed;
+}
+
+/**
+ * Function: Columnar Header
+ * Purpose: Builds a columnar export header with the given counts
+ * Input: courses - course count, edges - edge count, columns - column count
+ * Output: header bytes
+ */
+vector<unsigned char> columnarHeader(unsigned int courses, unsigned int edges, unsigned int columns) {
+    vector<unsigned char> bytes(COLUMNAR_MAGIC, COLUMNAR_MAGIC + 4);
+    appendLittleEndian(bytes, COLUMNAR_VERSION, 4);
+    appendLittleEndian(bytes, courses, 4);
+    appendLittleEndian(bytes, edges, 4);
+    appendLittleEndian(bytes, columns, 4);
+    return bytes;
+}
+
+/**
+ * Function: Check Columnar Round Trip
+ * Purpose: An exported catalog must import back with the same courses
+ * Output: true if the check passed
+ */
+bool checkColumnarRoundTrip() {
+    removeCheckFiles();
+    HashTable table = initializeHashTable(16);
+    table.verbose = false;
+    insertCourseIntoTable(table, makeCourse("CSCI100", "Introduction"));
+    Course course = makeCourse("CSCI200", "Data Structures");
+    course.prerequisites.push_back("CSCI100");
+    insertCourseIntoTable(table, course);
+    insertCourseIntoTable(table, makeCourse("MATH201", "Discrete Mathematics"));
+
+    CompactCatalog exported;
+    CompactCatalog imported;
+    size_t fileBytes = 0;
+    size_t bytesRead = 0;
+    bool passed = buildCompactCatalog(table, exported) && exportColumnarCatalog(exported, CHECK_COLUMNAR_PATH, fileBytes)
+        && importColumnarCatalog(CHECK_COLUMNAR_PATH, PROJECT_ALL, imported, bytesRead)
+        && imported.keys.size() == 3 && imported.namePool == exported.namePool
+        && imported.prerequisites == exported.prerequisites;
+    for (size_t id = 0; passed && id < imported.keys.size(); id++) {
+        passed = getCompactCourseNumber(imported, id) == getCompactCourseNumber(exported, id);
+    }
+    cleanupHashTable(table);
+    return passed;
+}
+
+/**
+ * Function: Check Columnar Oversized Counts
+ * Purpose: Header counts and directory lengths the file cannot hold must be rejected before any
+ *          buffer is sized from them
+ * Output: true if the check passed
+ */
+bool checkColumnarOversizedCounts() {
+    // One directory entry whose column claims 2^42 bytes of a 44-byte file
+    vector<unsigned char> longColumn = columnarHeader(1, 0, 1);
+    appendLittleEndian(longColumn, COLUMN_DEPARTMENTS, 4);
+    appendLittleEndian(longColumn, 0, 4);
+    appendLittleEndian(longColumn, COLUMNAR_HEADER_BYTES + COLUMNAR_DIRECTORY_ENTRY_BYTES, 8);
+    appendLittleEndian(longColumn, 1ULL << 42, 8);
+
+    const vector<unsigned char> files[] = {
+        longColumn,
+        columnarHeader(1, 0, 0xFFFFFFFF),   // Directory larger than the file
+        columnarHeader(0xFFFFFFFF, 0, 0),   // More courses than bytes
+        columnarHeader(0, 0xFFFFFFFF, 0),   // More edges than bytes
+    };
+    bool passed = true;
+    for (const vector<unsigned char>& bytes : files) {
+        CompactCatalog catalog;
+        size_t bytesRead = 0;
+        passed = writeCheckFile(CHECK_COLUMNAR_PATH, bytes)
+            && !importColumnarCatalog(CHECK_COLUMNAR_PATH, PROJECT_ALL, catalog, bytesRead)
+            && catalog.keys.empty() && passed;
+    }
+    return passed;
+}
+
+int main() {
+    struct Check {
+        const char* name;   // Printed with the result
+        bool (*run)();      // Returns true on success
+    };
+    const Check checks[] = {
+        { "oversized checkpoint course count", checkOversizedCheckpointCount },
+        { "failed group commit is rolled back", checkFailedCommitRollback },
+        { "crash between checkpoint rename and log truncate", checkCrashAfterCheckpointRename },
+        { "columnar export round trip", checkColumnarRoundTrip },
+        { "oversized columnar counts and lengths", checkColumnarOversizedCounts },
+    };
+
+    int failures = 0;
+    for (const Check& check : checks) {
+        bool passed = check.run();
+        cout << (passed ? "PASS: " : "FAIL: ") << check.name << endl;
+        failures += passed ? 0 : 1;
+    }
+    removeCheckFiles();
+
+    cout << (failures == 0 ? "All file checks passed" : to_string(failures) + " file check(s) failed") << endl;
+    return failures == 0 ? 0 : 1;
+}
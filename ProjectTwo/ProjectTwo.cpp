@@ -1,1027 +1,6808 @@
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <vector>
-#include <iomanip>
-
-using namespace std;
-
-/**
- * Course Structure
- * Contains course number, name, and list of prerequisites
- */
-struct Course {
-    string courseNumber;          // Unique identifier (e.g., "CSCI100")
-    string name;                  // Full course name
-    vector<string> prerequisites; // List of prerequisite course numbers
-};
-
-/**
- * Hash table node structure for chaining collision resolution
- */
-struct HashNode {
-    Course course;                 // Course object containing course data
-    HashNode* next = nullptr;      // Pointer to next node in chain (for collisions)
-};
-
-/**
- * Hash table structure with dynamic resizing capability
- */
-struct HashTable {
-    vector<HashNode*> buckets; // Array of pointers to hash nodes
-    int size = 0;                  // Current number of courses stored
-    int capacity= 0;              // Current number of buckets
-    double maxLoadFactor=0.7;      // Maximum load factor before resize (0.7)
-};
-
-/**
- * Function: Open and Read File
- * Purpose: Opens a file and reads all valid lines into a vector
- * Input: filename - path to the course data file, lines - reference to vector that will store file lines
- * Output: true if file was successfully read, false otherwise
- */
-bool readFileLines(string filename, vector<string>& lines) {
-    ifstream file(filename);
-
-    if (!file.is_open()) {
-        cout << "Error: Cannot open file '" << filename << "'" << endl;
-        return false;
-    }
-
-    string line;
-    while (getline(file, line)) {
-        // Check if line is not empty and not just whitespace
-        if (!line.empty()) {
-            // Simple whitespace check - if line has any non-space characters
-            bool hasContent = false;
-            for (char c : line) {
-                if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
-                    hasContent = true;
-                    break;
-                }
-            }
-            if (hasContent) {
-                lines.push_back(line);
-            }
-        }
-    }
-
-    file.close();
-
-    if (lines.size() == 0) {
-        cout << "Error: File is empty or contains no valid data" << endl;
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * Function: Parse Single Line
- * Purpose: Splits a line by commas and cleans up tokens
- * Input: line - raw line from file, tokens - reference to vector that will store parsed tokens
- * Output: true if line was successfully parsed, false if malformed
- */
-bool parseLine(string line, vector<string>& tokens) {
-    if (line.empty()) {
-        return false;
-    }
-
-    // Check if line is just whitespace
-    bool hasContent = false;
-    for (char c : line) {
-        if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
-            hasContent = true;
-            break;
-        }
-    }
-    if (!hasContent) {
-        return false;
-    }
-
-    // Split line by comma into tokens
-    tokens.clear();
-    string token = "";
-
-    for (char c : line) {
-        if (c == ',') {
-            tokens.push_back(token);
-            token = "";
-        }
-        else {
-            token += c;
-        }
-    }
-    // Add the last token
-    tokens.push_back(token);
-
-    // Clean up tokens: trim whitespace and remove empty tokens
-    for (int i = tokens.size() - 1; i >= 0; i--) {
-        // Trim leading and trailing whitespace
-        string& t = tokens[i];
-        size_t start = t.find_first_not_of(" \t\r\n");
-        size_t end = t.find_last_not_of(" \t\r\n");
-
-        if (start != string::npos && end != string::npos) {
-            t = t.substr(start, end - start + 1);
-        }
-        else {
-            t = "";
-        }
-
-        // Remove empty tokens
-        if (t.empty()) {
-            tokens.erase(tokens.begin() + i);
-        }
-    }
-
-    return tokens.size() > 0;
-}
-
-/**
- * Function: Validate Line Format
- * Purpose: Ensures each line has minimum required fields
- * Input: tokens - parsed line tokens, originalLine - for error reporting
- * Output: true if line format is valid, false otherwise
- */
-bool validateLineFormat(vector<string> tokens, string originalLine) {
-    if (tokens.size() < 2) {
-        cout << "Error: Line '" << originalLine << "' does not have minimum required parameters" << endl;
-        return false;
-    }
-
-    if (tokens[0].empty()) {
-        cout << "Error: Course number cannot be empty" << endl;
-        return false;
-    }
-
-    if (tokens[1].empty()) {
-        cout << "Error: Course name cannot be empty" << endl;
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * Function: Check if Course Exists
- * Purpose: Searches for a course number in the file data
- * Input: courseNumber - course to search for, allLines - all file lines
- * Output: true if course exists, false otherwise
- */
-bool courseExists(string courseNumber, vector<string> allLines) {
-    if (courseNumber.empty()) {
-        return false;
-    }
-
-    for (string line : allLines) {
-        vector<string> tokens;
-        if (parseLine(line, tokens) && tokens.size() >= 1) {
-            if (tokens[0] == courseNumber) {
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
-/**
- * Function: Check All Prerequisites Exist
- * Purpose: Validates that all prerequisites exist as courses in the file
- * Input: allLines - all lines from the file
- * Output: true if all prerequisites are valid, false otherwise
- */
-bool validatePrerequisites(vector<string> allLines) {
-    for (string line : allLines) {
-        vector<string> tokens;
-        if (!parseLine(line, tokens)) {
-            continue; // Skip malformed lines
-        }
-
-        // Check prerequisites (tokens 2 and beyond)
-        if (tokens.size() > 2) { // has prerequisites
-            for (size_t i = 2; i < tokens.size(); i++) {
-                string prerequisite = tokens[i];
-                if (!prerequisite.empty() && !courseExists(prerequisite, allLines)) {
-                    cout << "Error: Prerequisite '" << prerequisite << "' in course '" << tokens[0] << "' does not exist as a course" << endl;
-                    return false;
-                }
-            }
-        }
-    }
-
-    return true;
-}
-
-/**
- * Function: Validate Entire File
- * Purpose: Orchestrates all file validation steps
- * Input: lines - all lines read from file
- * Output: true if entire file is valid, false if any validation fails
- */
-bool validateFile(vector<string> lines) {
-    if (lines.size() == 0) {
-        cout << "Error: No valid lines found in file" << endl;
-        return false;
-    }
-
-    // Step 1: Check that all lines can be parsed and have valid format
-    for (string line : lines) {
-        vector<string> tokens;
-        if (!parseLine(line, tokens)) {
-            cout << "Error: Unable to parse line '" << line << "'" << endl;
-            return false;
-        }
-
-        if (!validateLineFormat(tokens, line)) {
-            return false;
-        }
-    }
-
-    // Step 2: Check that all prerequisites exist as courses
-    if (!validatePrerequisites(lines)) {
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * Function: Create Single Course Object
- * Purpose: Creates a Course object from a validated line of data
- * Input: line - validated line from file, course - reference to Course object to populate
- * Output: true if course was created successfully, false otherwise
- */
-bool createCourseObject(string line, Course& course) {
-    vector<string> tokens;
-    if (!parseLine(line, tokens) || tokens.size() < 2) {
-        return false; // Invalid line format
-    }
-
-    // Set required fields
-    course.courseNumber = tokens[0];
-    course.name = tokens[1];
-    course.prerequisites.clear();
-
-    // Add prerequisites (tokens 2 and beyond)
-    for (size_t i = 2; i < tokens.size(); i++) {
-        if (!tokens[i].empty()) {
-            course.prerequisites.push_back(tokens[i]);
-        }
-    }
-
-    return true;
-}
-
-/**
- * Function: Initialize Hash Table
- * Purpose: Creates and initializes a new hash table with specified capacity
- * Input: initialCapacity - starting number of buckets
- * Output: Initialized HashTable structure
- */
-HashTable initializeHashTable(int initialCapacity = 16) {
-    HashTable table;
-    table.capacity = initialCapacity;
-    table.size = 0;
-    table.maxLoadFactor = 0.7;
-
-    // Initialize all buckets to null
-    table.buckets.resize(initialCapacity);
-    for (int i = 0; i < initialCapacity; i++) {
-        table.buckets[i] = nullptr;
-    }
-
-    return table;
-}
-
-/**
- * Function: Hash Function
- * Purpose: Converts course number string to hash index using polynomial rolling hash
- * Input: courseNumber - string to hash, capacity - table size for modulo
- * Output: Hash index (0 to capacity-1)
- */
-int hashFunction(string courseNumber, int capacity) {
-    if (courseNumber.empty()) {
-        return 0;
-    }
-
-    int hash = 0;
-    int prime = 31; // Common prime for polynomial hash
-
-    for (size_t i = 0; i < courseNumber.length(); i++) {
-        char c = courseNumber[i];
-        hash = hash * prime + (int)c;
-    }
-
-    // Ensure positive result and fit within table capacity
-    return abs(hash) % capacity;
-}
-
-/**
- * Function: Calculate Load Factor
- * Purpose: Determines current load factor for resize decisions
- * Input: table - hash table to analyze
- * Output: Current load factor (size/capacity ratio)
- */
-double getLoadFactor(HashTable table) {
-    if (table.capacity == 0) {
-        return 0.0;
-    }
-    return (double)table.size / (double)table.capacity;
-}
-
-/**
- * Function: Display Hash Table Statistics
- * Purpose: Provides detailed statistics about hash table performance
- * Input: table - hash table to analyze
- * Output: Collision statistics, distribution analysis, performance metrics
- */
-void displayHashTableStats(const HashTable& table) {
-    cout << "\n=== Hash Table Performance Statistics ===" << endl;
-    cout << "Total courses: " << table.size << endl;
-    cout << "Table capacity: " << table.capacity << endl;
-    cout << "Load factor: " << fixed << setprecision(3) << getLoadFactor(table) << endl;
-
-    // Analyze collision distribution
-    int emptyBuckets = 0;
-    int maxChainLength = 0;
-    int totalCollisions = 0;
-    int bucketsWithCollisions = 0;
-
-    for (int i = 0; i < table.capacity; i++) {
-        int chainLength = 0;
-        HashNode* current = table.buckets[i];
-
-        if (current == nullptr) {
-            emptyBuckets++;
-        }
-        else {
-            // Count chain length
-            while (current != nullptr) {
-                chainLength++;
-                current = current->next;
-            }
-
-            // Track collision statistics
-            if (chainLength > 1) {
-                totalCollisions += (chainLength - 1);
-                bucketsWithCollisions++;
-            }
-
-            if (chainLength > maxChainLength) {
-                maxChainLength = chainLength;
-            }
-        }
-    }
-
-    // Calculate percentages
-    double emptyPercentage = (emptyBuckets * 100.0) / table.capacity;
-    double collisionPercentage = (bucketsWithCollisions * 100.0) / table.capacity;
-
-    cout << "Empty buckets: " << emptyBuckets << " (" << fixed << setprecision(1)
-        << emptyPercentage << "%)" << endl;
-    cout << "Buckets with collisions: " << bucketsWithCollisions << " ("
-        << fixed << setprecision(1) << collisionPercentage << "%)" << endl;
-    cout << "Maximum chain length: " << maxChainLength << endl;
-    cout << "Total collisions: " << totalCollisions << endl;
-
-    // Calculate average search operations
-    if (table.size > 0) {
-        double avgSearchOps = (double)(table.size + totalCollisions) / table.size;
-        cout << "Average search operations: " << fixed << setprecision(2) << avgSearchOps << endl;
-    }
-
-    // Performance assessment
-    cout << "\nPerformance Assessment:" << endl;
-    if (getLoadFactor(table) <= 0.7) {
-        cout << "Load factor is optimal (<= 0.7)" << endl;
-    }
-    else {
-        cout << "Load factor is high (> 0.7) - consider resizing" << endl;
-    }
-
-    if (maxChainLength <= 3) {
-        cout << "Collision chains are manageable (<= 3)" << endl;
-    }
-    else {
-        cout << "Some collision chains are long (> 3)" << endl;
-    }
-
-    cout << "=========================================" << endl;
-}
-
-/**
- * Function: Resize Hash Table
- * Purpose: Doubles table capacity and rehashes all existing courses
- * Input: table - reference to hash table to resize
- * Output: Updates table with new capacity and redistributed courses
- */
-void resizeHashTable(HashTable& table) {
-    // Store old buckets for rehashing
-    vector<HashNode*> oldBuckets = table.buckets;
-    int oldCapacity = table.capacity;
-
-    // Double the capacity
-    table.capacity = table.capacity * 2;
-    table.size = 0; // Will be recounted during rehashing
-
-    // Create new empty bucket array
-    table.buckets.clear();
-    table.buckets.resize(table.capacity);
-    for (int i = 0; i < table.capacity; i++) {
-        table.buckets[i] = nullptr;
-    }
-
-    // Rehash all existing courses into new table
-    for (int i = 0; i < oldCapacity; i++) {
-        HashNode* current = oldBuckets[i];
-        while (current != nullptr) {
-            HashNode* next = current->next; // Save next before reinsertion
-
-            // Calculate new hash index for the resized table
-            int newIndex = hashFunction(current->course.courseNumber, table.capacity);
-
-            // Insert directly into new table (no resize check needed)
-            current->next = table.buckets[newIndex];
-            table.buckets[newIndex] = current;
-            table.size++;
-
-            current = next;
-        }
-    }
-
-    cout << "Hash table resized from " << oldCapacity << " to " << table.capacity << " buckets" << endl;
-}
-
-/**
- * Function: Check and Resize if Needed
- * Purpose: Monitors load factor and triggers resize when necessary
- * Input: table - reference to hash table to check
- * Output: Resizes table if load factor > 0.7
- */
-void checkAndResize(HashTable& table) {
-    if (getLoadFactor(table) > table.maxLoadFactor) {
-		resizeHashTable(table);
-    }
-}
-
-/**
- * Function: Insert Course into Hash Table
- * Purpose: Adds a course to the hash table using chaining for collision resolution
- * Input: table - reference to hash table, course - Course object to insert
- * Output: Updates table with new course, handles collisions via chaining
- */
-void insertCourseIntoTable(HashTable& table, Course course) {
-    // Check if resize needed before insertion
-    checkAndResize(table);
-
-    // Calculate hash index for course
-    int index = hashFunction(course.courseNumber, table.capacity);
-
-    // Create new node for the course
-    HashNode* newNode = new HashNode();
-    newNode->course = course;
-    newNode->next = nullptr;
-
-    // Handle collision using chaining
-    if (table.buckets[index] == nullptr) {
-        // No collision - first course in this bucket
-        table.buckets[index] = newNode;
-    }
-    else {
-        // Collision detected - check for duplicate course numbers first
-        HashNode* current = table.buckets[index];
-        while (current != nullptr) {
-            if (current->course.courseNumber == course.courseNumber) {
-                // Update existing course instead of creating duplicate
-                current->course = course;
-                delete newNode; // Clean up unused node
-                return;
-            }
-            current = current->next;
-        }
-
-        // No duplicate found - add to front of chain
-        newNode->next = table.buckets[index];
-        table.buckets[index] = newNode;
-    }
-
-    table.size = table.size + 1;
-}
-
-/**
- * Collects all courses from the hash table into a vector for sorting
- * Traverses all buckets and collision chains to gather every course
- * @param table The hash table containing course data
- * @return Vector containing all courses from the hash table
- */
-vector<Course> collectAllCourses(const HashTable& table) {
-    vector<Course> allCourses;
-
-    // Traverse each bucket in the hash table
-    for (int i = 0; i < table.capacity; i++) {
-        HashNode* current = table.buckets[i];
-
-        // Traverse the collision chain at this bucket
-        while (current != nullptr) {
-            allCourses.push_back(current->course);
-            current = current->next;
-        }
-    }
-
-    return allCourses;
-}
-
-/**
- * Merges two sorted subarrays into one sorted array
- * @param courses Vector containing the subarrays
- * @param left Start of first subarray
- * @param middle End of first subarray (start of second is middle+1)
- * @param right End of second subarray
- */
-void merge(vector<Course>& courses, int left, int middle, int right) {
-    // Create temporary arrays for the two subarrays
-    vector<Course> leftArray;
-    vector<Course> rightArray;
-
-    // Copy data to temporary arrays
-    for (int i = left; i <= middle; i++) {
-        leftArray.push_back(courses[i]);
-    }
-
-    for (int j = middle + 1; j <= right; j++) {
-        rightArray.push_back(courses[j]);
-    }
-
-    // Merge the temporary arrays back into courses[left..right]
-    size_t i = 0;    // Initial index of first subarray
-    size_t j = 0;    // Initial index of second subarray
-    size_t k = left; // Initial index of merged subarray
-
-    while (i < leftArray.size() && j < rightArray.size()) {
-        // Compare course numbers for alphabetical ordering
-        if (leftArray[i].courseNumber <= rightArray[j].courseNumber) {
-            courses[k] = leftArray[i];
-            i++;
-        }
-        else {
-            courses[k] = rightArray[j];
-            j++;
-        }
-        k++;
-    }
-
-    // Copy remaining elements of leftArray, if any
-    while (i < leftArray.size()) {
-        courses[k] = leftArray[i];
-        i++;
-        k++;
-    }
-
-    // Copy remaining elements of rightArray, if any
-    while (j < rightArray.size()) {
-        courses[k] = rightArray[j];
-        j++;
-        k++;
-    }
-}
-
-/**
- * Recursive merge sort implementation
- * Divides the array into halves and recursively sorts each half
- * @param courses Vector to sort
- * @param left Starting index of the subarray
- * @param right Ending index of the subarray
- */
-void mergeSort(vector<Course>& courses, int left, int right) {
-    if (left < right) {
-        int middle = left + (right - left) / 2; // Avoid potential overflow
-
-        // Recursively sort first and second halves
-        mergeSort(courses, left, middle);
-        mergeSort(courses, middle + 1, right);
-
-        // Merge the sorted halves
-        merge(courses, left, middle, right);
-    }
-}
-
-/**
- * Sorts a vector of courses alphanumerically by course number
- * Uses merge sort algorithm for O(n log n) performance
- * @param courses Vector of Course objects to sort (modified in place)
- */
-void sortCoursesAlphanumerically(vector<Course>& courses) {
-    if (courses.size() <= 1) {
-        return; // Already sorted or empty
-    }
-
-    mergeSort(courses, 0, courses.size() - 1);
-}
-
-/**
- * Function: Print Single Course Info
- * Purpose: Displays basic course information in required format
- * Input: course - Course object to display
- * Output: Prints "courseNumber, courseName" to console
- */
-void printCourseInfo(const Course& course) {
-    cout << course.courseNumber << ", " << course.name << endl;
-}
-
-/**
- * Function: Print All Courses Sorted with Pagination
- * Purpose: Displays all courses from hash table in alphanumeric order with pagination
- * Input: table - hash table containing courses
- * Output: Displays all courses sorted by course number, 20 per page
- */
-void printAllCoursesSorted(const HashTable& table) {
-    if (table.size == 0) {
-        cout << "No courses loaded. Please load data first using option 1." << endl;
-        return;
-    }
-
-    // Collect all courses from hash table
-    vector<Course> allCourses = collectAllCourses(table);
-
-    // Sort the courses alphanumerically
-    sortCoursesAlphanumerically(allCourses);
-
-    // Display the sorted course list with pagination
-    cout << "Here is a sample schedule:\n" << endl;
-
-    int pageSize = 10;
-    int currentPage = 1;
-    int totalPages = (allCourses.size() + pageSize - 1) / pageSize; // Ceiling division
-
-    for (size_t i = 0; i < allCourses.size(); i++) {
-        // Print page header at the start of each page
-        if (i % pageSize == 0) {
-            if (i > 0) {
-                // Add blank line before pagination prompt
-                cout << endl;
-                cout << "Press Enter to continue to page " << (currentPage + 1)
-                    << " of " << totalPages << "..." << endl;
-                cin.get(); // Wait for Enter key
-                cout << endl; // Add blank line after user input
-                currentPage++; // Move to next page after user input
-            }
-
-            if (totalPages > 1) {
-                cout << "--- Page " << currentPage << " of " << totalPages << " ---" << endl;
-                cout << endl; // Add blank line after page header
-            }
-        }
-
-        printCourseInfo(allCourses[i]);
-    }
-
-    cout << "\nTotal courses displayed: " << allCourses.size() << endl;
-    cout << endl; // Add blank line for separation before menu redisplays
-}
-
-/**
- * Function: Search Course in Hash Table
- * Purpose: Efficiently finds a course using hash table lookup
- * Input: table - hash table to search, courseNumber - course to find,
- *        foundCourse - reference to Course object to populate if found
- * Output: true if course found, false otherwise
- * Complexity: Average O(1), worst case O(n) if many collisions
- */
-bool searchCourse(const HashTable& table, const string& courseNumber, Course& foundCourse) {
-    if (courseNumber.empty()) {
-        return false;
-    }
-
-    // Calculate hash index
-    int index = hashFunction(courseNumber, table.capacity);
-
-    // Search through chain at this index
-    HashNode* current = table.buckets[index];
-
-    while (current != nullptr) {
-        if (current->course.courseNumber == courseNumber) {
-            foundCourse = current->course;
-            return true;
-        }
-        current = current->next;
-    }
-
-    return false; // Course not found
-}
-
-/**
- * Function: Print Prerequisites
- * Purpose: Displays all prerequisites for a course using hash table lookups
- * Input: course - Course object whose prerequisites to display,
- *        table - hash table for prerequisite lookups
- * Output: Prints prerequisite course information or "No prerequisites required"
- */
-void printPrerequisites(const Course& course, const HashTable& table) {
-    if (course.prerequisites.size() == 0) {
-        cout << "No prerequisites required" << endl;
-        return;
-    }
-
-    cout << "Prerequisites: ";
-
-    for (size_t i = 0; i < course.prerequisites.size(); i++) {
-        Course prereqCourse;
-        if (searchCourse(table, course.prerequisites[i], prereqCourse)) {
-            cout << prereqCourse.courseNumber << ", " << prereqCourse.name;
-        }
-        else {
-            cout << "Warning: Prerequisite " << course.prerequisites[i] << " not found";
-        }
-
-        // Add comma separator between prerequisites (except for last one)
-        if (i < course.prerequisites.size() - 1) {
-            cout << "; ";
-        }
-    }
-
-    cout << endl;
-}
-
-/**
- * Function: Clean Up Hash Table
- * Purpose: Deallocates all memory used by hash table
- * Input: table - reference to hash table to clean up
- * Output: Frees all nodes and resets table to empty state
- */
-void cleanupHashTable(HashTable& table) {
-    // Traverse all buckets in the hash table
-    for (int i = 0; i < table.capacity; i++) {
-        HashNode* current = table.buckets[i];
-
-        // Delete all nodes in the collision chain at this bucket
-        while (current != nullptr) {
-            HashNode* next = current->next;
-            delete current;
-            current = next;
-        }
-
-        // Set bucket pointer to null
-        table.buckets[i] = nullptr;
-    }
-
-    // Reset table properties
-    table.size = 0;
-
-    cout << "Hash table memory cleaned up successfully" << endl;
-}
-
-/**
- * Trims leading/trailing whitespace and quotes from filename
- */
-string trimFilename(const string& filename) {
-    size_t start = filename.find_first_not_of(" \t\"'");
-    size_t end = filename.find_last_not_of(" \t\"'");
-
-    if (start != string::npos && end != string::npos) {
-        return filename.substr(start, end - start + 1);
-    }
-    return filename;
-}
-
-/**
- * Validates if filename has .csv extension (case insensitive)
- */
-bool isValidCsvExtension(const string& filename) {
-    if (filename.length() < 4) {
-        return false;
-    }
-
-    string extension = filename.substr(filename.length() - 4);
-    return (extension == ".csv" || extension == ".CSV");
-}
-
-/**
- * Checks if file exists and can be opened
- */
-bool fileExists(const string& filename) {
-    ifstream file(filename);
-    bool exists = file.is_open();
-    if (exists) {
-        file.close();
-    }
-    return exists;
-}
-
-/**
- * Gets raw filename input from user
- */
-string getUserInput() {
-    string filename;
-    cout << "Enter filename (must be .csv format): ";
-    getline(cin, filename);
-    return filename;
-}
-
-/**
- * Prompts user for filename and validates file exists and is CSV format
- * Keeps asking until a valid CSV file is provided
- * Returns the filename when valid CSV file is found
- */
-string getValidFilename() {
-    while (true) {
-        string filename = getUserInput();
-
-        // Check if filename is empty
-        if (filename.empty()) {
-            cout << "Error: Filename cannot be empty" << endl;
-            continue;
-        }
-
-        // Clean the filename
-        filename = trimFilename(filename);
-
-        // Validate CSV extension
-        if (!isValidCsvExtension(filename)) {
-            cout << "Error: File must have .csv extension" << endl;
-            continue;
-        }
-
-        // Check if file exists
-        if (!fileExists(filename)) {
-            cout << "Error: Cannot open file '" << filename << "'" << endl;
-            continue;
-        }
-
-        cout << "CSV file '" << filename << "' found successfully!" << endl;
-        return filename;
-    }
-}
-
-/**
- * Displays the main menu options
- */
-void displayMenu() {
-    cout << endl;
-    cout << "1. Load Data Structure." << endl;
-    cout << "2. Print Course List." << endl;
-    cout << "3. Print Course." << endl;
-    cout << "9. Exit" << endl;
-    cout << "What would you like to do? ";
-}
-
-/**
- * Validates menu choice input
- */
-bool isValidMenuChoice(const string& choice) {
-    return (choice == "1" || choice == "2" || choice == "3" || choice == "9");
-}
-
-/**
- * Gets and validates menu choice from user
- */
-string getMenuChoice() {
-    string choice;
-    getline(cin, choice);
-    return choice;
-}
-
-/**
- * Function: Menu Option 1 - Load Data Structure
- * Purpose: Handles loading course data into hash table with comprehensive error handling
- * Input: table - reference to hash table to populate
- * Output: Hash table is populated with validated course data
- */
-void menuOption1(const string& filename, HashTable& table) {
-    cout << "\nLoading data structure..." << endl;
-
-    vector<string> lines;
-
-    // Step 1: Read file contents
-    if (!readFileLines(filename, lines)) {
-        return;
-    }
-
-    // Step 2: Validate file format and prerequisites
-    if (!validateFile(lines)) {
-        cout << "Failed to load courses from file. Please check the file format and try again." << endl;
-        return;
-    }
-
-    // Step 3: Create course objects and insert into hash table
-    for (string line : lines) {
-        Course newCourse;
-        if (createCourseObject(line, newCourse)) {
-            insertCourseIntoTable(table, newCourse);
-        }
-        else {
-            cout << "Warning: Skipping invalid line during course creation" << endl;
-        }
-    }
-
-    cout << "Courses loaded successfully into hash table!" << endl;
-    cout << "Number of courses loaded: " << table.size << endl;
-    cout << "Hash table capacity: " << table.capacity << endl;
-    cout << "Current load factor: " << getLoadFactor(table) << endl;
-
-    // Display detailed hash table statistics
-    displayHashTableStats(table);
-}
-
-/**
- * Function: Menu Option 2 - Print Course List
- * Purpose: Prints all courses in alphanumeric order with error handling
- * Input: table - hash table containing courses
- * Output: All courses displayed in alphanumeric order by course number
- */
-void menuOption2(const HashTable& table) {
-    printAllCoursesSorted(table);
-}
-
-/**
- * Function: Menu Option 3 - Print Course
- * Purpose: Searches for and displays specific course information with prerequisites
- * Input: table - hash table containing courses
- * Output: Displays course information and prerequisites, or error message
- */
-void menuOption3(const HashTable& table) {
-    if (table.size == 0) {
-        cout << "No courses loaded. Please load data first using option 1." << endl;
-        return;
-    }
-
-    string courseNumber;
-    cout << "What course do you want to know about? ";
-    getline(cin, courseNumber);
-
-    if (courseNumber.empty()) {
-        cout << "Error: Course number cannot be empty" << endl;
-        return;
-    }
-
-    // Convert to uppercase for case-insensitive search
-    for (char& c : courseNumber) {
-        c = toupper(c);
-    }
-
-    Course foundCourse;
-    if (searchCourse(table, courseNumber, foundCourse)) {
-        cout << endl << "Course Information:" << endl;
-        cout << "===================" << endl;
-        printCourseInfo(foundCourse);
-        cout << endl;
-        printPrerequisites(foundCourse, table);
-    }
-    else {
-        cout << "Course '" << courseNumber << "' not found." << endl;
-        cout << "Please check the course number and try again." << endl;
-    }
-}
-
-
-
-
-int main() {
-
-    // Near the top of main(), after getting the filename:
-    HashTable courseTable = initializeHashTable(16);
-
-    cout << "Welcome to the ABCU Course Management System" << endl;
-    cout << "===========================================" << endl;
-
-    string filename = getValidFilename();
-
-    cout << "Ready to process file: " << filename << endl;
-
-    // Transition to menu system
-    cout << "\nWelcome to the course planner." << endl;
-
-    bool running = true;
-
-    while (running) {
-        displayMenu();
-        string choice = getMenuChoice();
-
-        if (!isValidMenuChoice(choice)) {
-            cout << choice << " is not a valid option." << endl;
-            continue;
-        }
-
-        if (choice == "1") {
-            menuOption1(filename, courseTable);
-        }
-        else if (choice == "2") {
-            menuOption2(courseTable);
-        }
-        else if (choice == "3") {
-            menuOption3(courseTable);
-        }
-        else if (choice == "9") {
-            cout << "\nCleaning up memory..." << endl;
-            cleanupHashTable(courseTable);
-            cout << "\nThank you for using the course planner!\n" << endl;
-            cout << "Press Enter to exit...";
-            cin.get(); // Wait for user to press Enter before exiting
-            running = false;
-        }
-    }
-    
-
-    return 0;
-}
\ No newline at end of file
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <shared_mutex>
+#include <functional>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#include <io.h>
+#include <fcntl.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+/**
+ * Course Structure
+ * Contains course number, name, and list of prerequisites
+ */
+struct Course {
+    string courseNumber;          // Unique identifier (e.g., "CSCI100")
+    string name;                  // Full course name
+    vector<string> prerequisites; // List of prerequisite course numbers
+};
+
+/**
+ * Hash table node structure for chaining collision resolution
+ */
+struct HashNode {
+    Course course;                 // Course object containing course data
+    HashNode* next = nullptr;      // Pointer to next node in chain (for collisions)
+};
+
+/**
+ * Hash table structure with dynamic resizing capability
+ */
+struct HashTable {
+    vector<HashNode*> buckets; // Array of pointers to hash nodes
+    int size = 0;                  // Current number of courses stored
+    int capacity= 0;              // Current number of buckets
+    double maxLoadFactor=0.7;      // Maximum load factor before resize (0.7)
+    bool verbose = true;           // Print resize and cleanup messages
+};
+
+/**
+ * Skip entry for jumping over blocks of a compressed posting list
+ */
+struct PostingSkip {
+    int firstDoc = 0;       // First document id stored in the block
+    int previousDoc = -1;   // Document id preceding the block (delta base)
+    size_t byteOffset = 0;  // Offset of the block in the encoded byte stream
+};
+
+/**
+ * Compressed posting list for a single course name term
+ * Postings are stored as varint(docDelta), varint(termFrequency), varint(positionDelta)...
+ */
+struct PostingList {
+    vector<unsigned char> bytes;  // Varint-encoded postings in ascending document order
+    vector<PostingSkip> skips;    // One skip entry per POSTING_BLOCK_SIZE postings
+    int docCount = 0;             // Number of courses whose name contains the term
+    int lastDoc = -1;             // Last document id appended (used while building)
+};
+
+/**
+ * Inverted index over course names, rebuilt every time data is loaded and updated per course by edits
+ */
+struct NameIndex {
+    vector<string> courseNumbers;             // Document id -> course number (sorted order up to sortedDocs)
+    vector<int> nameLengths;                  // Document id -> number of terms in the name
+    vector<bool> removedDocs;                 // Document id -> removed by an edit (postings stay until a rebuild)
+    unordered_map<string, PostingList> terms; // Term -> compressed posting list
+    size_t sortedDocs = 0;                    // Documents built in course number order; later ids were added by edits
+    size_t liveDocs = 0;                      // Documents not removed
+    long long totalTerms = 0;                 // Terms across live documents
+    double averageNameLength = 0.0;           // Average name length in terms (for ranking)
+};
+
+/**
+ * Single ranked result of a course name query
+ */
+struct NameMatch {
+    int docId = 0;      // Document id of the matching course
+    double score = 0.0; // Relevance score (higher is better)
+};
+
+const int POSTING_BLOCK_SIZE = 64; // Postings per skip block
+
+/**
+ * Deletion index for "did you mean" suggestions on missed course lookups (SymSpell)
+ * Every course number is stored under each variant obtained by deleting up to
+ * SUGGESTION_MAX_DISTANCE characters, keyed by a 32-bit hash of the variant. The top
+ * directoryBits of the hash pick a bucket, so each variant needs one 32-bit entry: the
+ * next hash bits above the code id (collisions are filtered by the edit distance check)
+ */
+struct SuggestionIndex {
+    vector<string> codes;                 // Code id -> course number
+    vector<unsigned int> directory;       // Bucket -> first entry (one extra end offset)
+    vector<unsigned int> entries;         // (hash bits below the bucket, code id) per variant, sorted
+    int directoryBits = 0;                // Hash bits that pick the bucket
+    unsigned int idMask = 0;              // Entry bits holding the code id
+};
+
+const size_t SUGGESTION_BUCKET_ENTRIES = 8; // Target entries per directory bucket
+const int SUGGESTION_MAX_DIRECTORY_BITS = 24; // Largest directory (16M buckets)
+
+const int SUGGESTION_MAX_DISTANCE = 2; // Largest edit distance offered as a suggestion
+const size_t SUGGESTION_COUNT = 3;     // Number of suggestions shown after a miss
+
+/**
+ * Reverse prerequisite index: for each course, the courses that list it as a prerequisite
+ * Edges are stored in compressed sparse row form; transitive impact sets are memoized
+ * until the next load rebuilds the index
+ */
+struct DependencyIndex {
+    vector<string> codes;                            // Course id -> course number (sorted)
+    unordered_map<string, int> ids;                  // Course number -> course id
+    vector<int> dependentOffsets;                    // Course id -> start of its dependents (size = courses + 1)
+    vector<int> dependents;                          // Dependent course ids, grouped by prerequisite
+    unordered_map<int, vector<int>> impactCache;     // Course id -> memoized transitive dependents
+};
+
+const size_t COMPACT_KEY_WIDTH = 16; // Bytes per packed course number (longer numbers disable the compact store)
+
+/**
+ * Course number packed into a fixed-width, zero-padded key; memcmp order equals string order
+ */
+struct PackedKey {
+    char bytes[COMPACT_KEY_WIDTH]; // Course number characters followed by zero bytes
+};
+
+/**
+ * Structure-of-arrays copy of the catalog, sorted by course number
+ * Course numbers are packed keys, every name lives in one string pool addressed by
+ * offset (length = next offset - offset), and prerequisites are flat ranges of course ids
+ */
+struct CompactCatalog {
+    vector<PackedKey> keys;                   // Course id -> packed course number (sorted)
+    vector<unsigned int> nameOffsets;         // Course id -> start of its name in namePool (size = courses + 1)
+    string namePool;                          // Every course name back to back
+    vector<unsigned int> prerequisiteOffsets; // Course id -> start of its prerequisites (size = courses + 1)
+    vector<unsigned int> prerequisites;       // Prerequisite course ids, grouped by course
+};
+
+/**
+ * Columns of a columnar catalog export, in file order
+ */
+enum ColumnarColumn {
+    COLUMN_DEPARTMENTS = 1,          // Department prefix dictionary: u32 count, u32 offsets[count + 1], characters
+    COLUMN_DEPARTMENT_IDS = 2,       // u8 width (1, 2 or 4), then one little-endian prefix id per course
+    COLUMN_KEY_SUFFIXES = 3,         // Per course: varint bytes shared with the previous suffix, varint length, bytes
+    COLUMN_NAME_OFFSETS = 4,         // u32 offsets[courses + 1] into the name column
+    COLUMN_NAMES = 5,                // Every course name back to back
+    COLUMN_PREREQUISITE_OFFSETS = 6, // u32 offsets[courses + 1] into the prerequisite column
+    COLUMN_PREREQUISITES = 7,        // u32 prerequisite course ids, grouped by course
+    COLUMN_COUNT = 7
+};
+
+/**
+ * Column groups a reader can ask for
+ */
+enum ColumnarProjection {
+    PROJECT_KEYS = 1,          // Course numbers (department, id and suffix columns)
+    PROJECT_NAMES = 2,         // Name offsets and names
+    PROJECT_PREREQUISITES = 4, // Prerequisite offsets and edges
+    PROJECT_ALL = 7
+};
+
+const char COLUMNAR_MAGIC[4] = { 'P', 'T', 'C', 'C' };       // Columnar export signature
+const unsigned int COLUMNAR_VERSION = 1;                      // Columnar export format version
+const char* const COLUMNAR_EXPORT_PATH = "catalog_export.ptcc"; // Default export file
+const size_t COLUMNAR_HEADER_BYTES = 20;                      // Magic, version, courses, edges, column count
+const size_t COLUMNAR_DIRECTORY_ENTRY_BYTES = 24;             // u32 column, u32 CRC-32, u64 offset, u64 length
+
+const int TERM_OPEN = INT_MAX;                                                // toTerm of a record still in effect
+const char* const TERM_SEASONS[4] = { "Winter", "Spring", "Summer", "Fall" }; // Term code = year * 4 + season
+const char* const CATALOG_HISTORY_PATH = "catalog_history.bin";              // Saved term history
+const char CATALOG_HISTORY_MAGIC[4] = { 'P', 'T', 'C', 'H' };                 // History file signature
+const unsigned int CATALOG_HISTORY_VERSION = 1;                               // History file format version
+
+/**
+ * One record of a course and the terms it was in effect, [fromTerm, toTerm)
+ */
+struct CourseVersion {
+    Course course;                // Course as the catalog listed it
+    int fromTerm = 0;             // First term the record applies to
+    int toTerm = TERM_OPEN;       // Term whose catalog replaced or withdrew it
+};
+
+/**
+ * Multi-version course catalog recorded one term at a time
+ * A course gets a new record only when a term's catalog adds, changes or withdraws it; an
+ * unchanged course keeps one record whose range spans every term, so every term's catalog
+ * shares it and memory grows with the number of changes rather than terms x courses
+ */
+struct CatalogHistory {
+    unordered_map<string, vector<CourseVersion>> versions; // Course number -> records, oldest first
+    vector<int> terms;                                      // Recorded terms, ascending
+    size_t records = 0;                                     // Records across all courses
+};
+
+/**
+ * Differences between a recorded term and the term before it
+ */
+struct TermChanges {
+    size_t added = 0;     // Courses new in this term (or offered again)
+    size_t changed = 0;   // Courses whose name or prerequisites changed
+    size_t withdrawn = 0; // Courses no longer in the catalog
+    size_t unchanged = 0; // Courses sharing the previous term's record
+};
+
+/**
+ * Kinds of record in the course edit log
+ */
+enum CourseEditType {
+    EDIT_ADD = 1,    // New course
+    EDIT_UPDATE = 2, // Replace an existing course
+    EDIT_REMOVE = 3  // Delete a course (only the course number is stored)
+};
+
+/**
+ * One decoded edit (log records and checkpoint entries share this form)
+ */
+struct CourseEdit {
+    unsigned char type = EDIT_ADD;    // CourseEditType
+    unsigned long long sequence = 0;  // Edit sequence number (0 in checkpoints)
+    Course course;                    // Course after the edit (number only for removals)
+};
+
+/**
+ * Append-only write-ahead log of course edits plus the checkpoint it is replayed on top of
+ * Edits are buffered and written with one fsync per group of groupCommitSize records; once the
+ * log outgrows the checkpoint it is compacted into a new checkpoint and truncated. A group whose
+ * commit fails is undone in the table, so the table never holds an edit the log lost
+ */
+struct CourseLog {
+    string logPath;                       // Append-only edit log
+    string checkpointPath;                // Latest compacted snapshot of the whole table
+    int fd = -1;                          // Open log file (-1 = edits not enabled yet)
+    vector<unsigned char> pending;        // Encoded records not yet written
+    size_t pendingRecords = 0;            // Records in pending
+    vector<CourseEdit> undo;              // Inverse of each pending record, oldest first (undone if the commit fails)
+    size_t groupCommitSize = 32;          // Records per write + fsync
+    unsigned long long nextSequence = 1;  // Sequence number of the next edit
+    unsigned long long logBytes = 0;      // Bytes written to the log since the last checkpoint
+    unsigned long long checkpointBytes = 0; // Size of the last checkpoint
+    unsigned long long compactMinBytes = 4 << 20; // Never compact a log smaller than this
+    size_t syncCount = 0;                 // fsync calls issued (log and checkpoint)
+    bool editingDisabled = false;         // Recovery failed; no edits until the user starts a new log
+};
+
+const char* const COURSE_LOG_PATH = "course_edits.log";             // Default edit log
+const char* const COURSE_CHECKPOINT_PATH = "course_checkpoint.bin"; // Default checkpoint
+const char COURSE_CHECKPOINT_MAGIC[4] = { 'P', 'T', 'C', 'K' };     // Checkpoint file signature
+const unsigned int COURSE_CHECKPOINT_VERSION = 1;                   // Checkpoint format version
+const size_t COURSE_RECORD_MIN_BYTES = 17;                          // Length + CRC header and the smallest valid payload
+
+/**
+ * Course record in a catalog compiled into the program (see EmbedGenerator.cpp)
+ */
+struct EmbeddedCourse {
+    const char* courseNumber;       // Course number
+    const char* name;               // Course name
+    unsigned int firstPrerequisite; // Start of its prerequisite ids in EMBEDDED_PREREQUISITES
+    unsigned int prerequisiteCount; // Number of prerequisites
+};
+
+const unsigned int EMBEDDED_EMPTY_SLOT = 0xFFFFFFFFu; // Perfect-hash slot that holds no course
+
+// Kiosk builds define PROJECTTWO_EMBEDDED_CATALOG and put the generated header on the include
+// path; other builds get empty tables so the lookup code needs no conditionals
+#ifdef PROJECTTWO_EMBEDDED_CATALOG
+#include "EmbeddedCatalog.h"
+#else
+const char* const EMBEDDED_CATALOG_SOURCE = "";
+constexpr unsigned int EMBEDDED_COURSE_COUNT = 0;
+constexpr EmbeddedCourse EMBEDDED_COURSES[1] = { { "", "", 0, 0 } };
+constexpr unsigned int EMBEDDED_PREREQUISITES[1] = { 0 };
+constexpr unsigned int EMBEDDED_BUCKET_COUNT = 1;
+constexpr unsigned int EMBEDDED_SEEDS[1] = { 0 };
+constexpr unsigned int EMBEDDED_SLOT_COUNT = 1;
+constexpr unsigned int EMBEDDED_SLOTS[1] = { EMBEDDED_EMPTY_SLOT };
+#endif
+
+/*
+ * Runtime instrumentation
+ * Latency histograms and load-phase timers around the hot paths. Each thread
+ * records into its own block (no shared writes); the stats command merges the
+ * blocks. Per-call operations (parse, insert, search) count every call but time
+ * only one call in LATENCY_SAMPLE_INTERVAL, so a lookup does not pay for two clock
+ * reads. Define PROJECTTWO_DISABLE_INSTRUMENTATION to compile all of it out.
+ */
+enum InstrumentedOperation {
+    OP_READ_FILE,     // readFileLines
+    OP_VALIDATE,      // validateFile (whole-catalog checks of any load)
+    OP_PARSE,         // createCourseObject (per line; per row in the streamed loader's parser)
+    OP_INSERT,        // insertCourseIntoTable (per course, includes resizes)
+    OP_RESIZE,        // resizeHashTable
+    OP_SEARCH,        // searchCourse
+    OP_LIST_SORTED,   // printAllCoursesSorted collect + sort (excludes paging waits)
+    OP_COUNT
+};
+
+enum LoadPhase {
+    PHASE_READ,       // Step 1 of menuOption1 (reader thread busy time for a single streamed file)
+    PHASE_VALIDATE,   // Step 2 (cross-row checks after the pipeline for a streamed file)
+    PHASE_INSERT,     // Step 3 (parse + insert every line; parser + inserter busy time for a streamed file)
+    PHASE_INDEXES,    // Steps 4-6 (name, suggestion and dependency indexes)
+    PHASE_TOTAL,      // Whole load
+    PHASE_COUNT
+};
+
+const char* const OPERATION_NAMES[OP_COUNT] = { "readFileLines", "validateFile", "createCourseObject",
+    "insertCourseIntoTable", "resizeHashTable", "searchCourse", "printAllCoursesSorted" };
+const char* const PHASE_NAMES[PHASE_COUNT] = { "read", "validate", "insert", "indexes", "total" };
+
+/**
+ * Function: Read Proc Status Kilobytes
+ * Purpose: Reads one "Name:   1234 kB" field of /proc/self/status (Linux)
+ * Input: field - field name including the colon (e.g. "VmHWM:")
+ * Output: Bytes, or 0 when the field is not available
+ */
+unsigned long long readProcStatusBytes(const char* field) {
+    ifstream status("/proc/self/status");
+    string line;
+    size_t length = strlen(field);
+    while (getline(status, line)) {
+        if (line.compare(0, length, field) == 0) {
+            return strtoull(line.c_str() + length, nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Function: Get Peak RSS Bytes
+ * Purpose: Returns the process's peak resident set size
+ * Output: Bytes since start, or since the last successful resetPeakRss(); 0 if unknown
+ */
+unsigned long long getPeakRssBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return (unsigned long long)counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    // VmHWM follows resetPeakRss(); getrusage never goes down
+    unsigned long long peak = readProcStatusBytes("VmHWM:");
+    if (peak > 0) {
+        return peak;
+    }
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return (unsigned long long)usage.ru_maxrss;          // bytes on macOS
+#else
+    return (unsigned long long)usage.ru_maxrss * 1024;   // kilobytes on Linux
+#endif
+#endif
+}
+
+/**
+ * Function: Get Current RSS Bytes
+ * Purpose: Returns the process's resident set size now
+ * Output: Bytes, or 0 if unknown
+ */
+unsigned long long getCurrentRssBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return (unsigned long long)counters.WorkingSetSize;
+    }
+    return 0;
+#else
+    return readProcStatusBytes("VmRSS:");
+#endif
+}
+
+/**
+ * Function: Reset Peak RSS
+ * Purpose: Restarts peak RSS tracking at the current RSS, so the next getPeakRssBytes() covers
+ *          only what ran in between
+ * Output: true if supported (Linux 4.0+); otherwise the peak stays cumulative
+ */
+bool resetPeakRss() {
+#if defined(__linux__)
+    ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.close();
+    return clearRefs.good();
+#else
+    return false;
+#endif
+}
+
+#ifndef PROJECTTWO_DISABLE_INSTRUMENTATION
+
+const int HISTOGRAM_SUB_BITS = 4;                                   // 16 sub-buckets per power of two (~6% precision)
+const int HISTOGRAM_SUB_COUNT = 1 << HISTOGRAM_SUB_BITS;
+const int HISTOGRAM_BUCKETS = (64 - HISTOGRAM_SUB_BITS) * HISTOGRAM_SUB_COUNT; // Covers every 64-bit nanosecond value
+const unsigned long long LATENCY_SAMPLE_INTERVAL = 64;              // Sampled operations time 1 call in 64
+
+/**
+ * Log-linear (HDR-style) latency histogram in nanoseconds, written by one thread
+ */
+struct LatencyHistogram {
+    atomic<unsigned long long> buckets[HISTOGRAM_BUCKETS]; // Sample counts per bucket
+    atomic<unsigned long long> calls;                      // Calls made (timed or not)
+    atomic<unsigned long long> count;                      // Number of samples
+    atomic<unsigned long long> totalNanos;                 // Sum of all samples
+    atomic<unsigned long long> maxNanos;                   // Largest sample
+};
+
+/**
+ * Per-thread statistics block; registered once and kept until exit so
+ * samples from finished threads are still reported
+ */
+struct ThreadStats {
+    LatencyHistogram operations[OP_COUNT];  // Latency per instrumented operation
+    atomic<unsigned long long> phaseNanos[PHASE_COUNT]; // Phase durations of this thread's last load
+    atomic<unsigned long long> phasePeakRss[PHASE_COUNT]; // Peak RSS bytes during each phase of that load
+    atomic<bool> phasePeakRssReset;                     // Whether the peaks are per phase (else since start)
+    atomic<unsigned long long> overlappedNanos;         // Wall time of the last load's read/parse/insert pipeline (0 = phases ran in turn)
+};
+
+/**
+ * Registry of every thread's statistics block
+ */
+struct StatsRegistry {
+    mutex lock;                              // Guards blocks
+    vector<unique_ptr<ThreadStats>> blocks;  // One block per thread that recorded a sample
+};
+
+/**
+ * Function: Get Stats Registry
+ * Purpose: Returns the process-wide registry (created on first use)
+ */
+StatsRegistry& getStatsRegistry() {
+    static StatsRegistry registry;
+    return registry;
+}
+
+/**
+ * Function: Get Thread Stats
+ * Purpose: Returns the calling thread's statistics block, registering it on first use
+ * Output: Block owned by the registry; only the calling thread writes to it
+ */
+ThreadStats& getThreadStats() {
+    thread_local ThreadStats* stats = nullptr;
+    if (stats == nullptr) {
+        unique_ptr<ThreadStats> block(new ThreadStats());
+        for (int op = 0; op < OP_COUNT; op++) {
+            LatencyHistogram& histogram = block->operations[op];
+            for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+                histogram.buckets[b].store(0, memory_order_relaxed);
+            }
+            histogram.calls.store(0, memory_order_relaxed);
+            histogram.count.store(0, memory_order_relaxed);
+            histogram.totalNanos.store(0, memory_order_relaxed);
+            histogram.maxNanos.store(0, memory_order_relaxed);
+        }
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            block->phaseNanos[phase].store(0, memory_order_relaxed);
+            block->phasePeakRss[phase].store(0, memory_order_relaxed);
+        }
+        block->phasePeakRssReset.store(false, memory_order_relaxed);
+        block->overlappedNanos.store(0, memory_order_relaxed);
+
+        StatsRegistry& registry = getStatsRegistry();
+        lock_guard<mutex> guard(registry.lock);
+        stats = block.get();
+        registry.blocks.push_back(move(block));
+    }
+    return *stats;
+}
+
+/**
+ * Function: Histogram Bucket Index
+ * Purpose: Maps a latency to its log-linear bucket
+ * Input: nanos - latency in nanoseconds
+ * Output: Bucket index (exact below 16 ns, then 16 buckets per power of two)
+ */
+int histogramBucket(unsigned long long nanos) {
+    if (nanos < (unsigned long long)HISTOGRAM_SUB_COUNT) {
+        return (int)nanos;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    int highestBit = 63 - __builtin_clzll(nanos);
+#else
+    int highestBit = 63;
+    while ((nanos >> highestBit) == 0) {
+        highestBit--;
+    }
+#endif
+    int shift = highestBit - HISTOGRAM_SUB_BITS;
+    return (shift + 1) * HISTOGRAM_SUB_COUNT + (int)((nanos >> shift) - HISTOGRAM_SUB_COUNT);
+}
+
+/**
+ * Function: Histogram Bucket Upper Bound
+ * Purpose: Largest latency that falls into a bucket (used for percentiles)
+ * Input: bucket - bucket index
+ * Output: Upper bound in nanoseconds
+ */
+unsigned long long histogramBucketLimit(int bucket) {
+    if (bucket < HISTOGRAM_SUB_COUNT) {
+        return (unsigned long long)bucket;
+    }
+    int shift = bucket / HISTOGRAM_SUB_COUNT - 1;
+    unsigned long long subBucket = (unsigned long long)(bucket % HISTOGRAM_SUB_COUNT + HISTOGRAM_SUB_COUNT);
+    return ((subBucket + 1) << shift) - 1;
+}
+
+/**
+ * Function: Record Latency
+ * Purpose: Adds one sample to the calling thread's histogram for an operation
+ * Input: operation - instrumented operation, nanos - measured latency
+ * Output: Owner-only relaxed load/store pairs, so recording never contends
+ */
+void recordLatency(InstrumentedOperation operation, unsigned long long nanos) {
+    LatencyHistogram& histogram = getThreadStats().operations[operation];
+    atomic<unsigned long long>& bucket = histogram.buckets[histogramBucket(nanos)];
+
+    bucket.store(bucket.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    histogram.count.store(histogram.count.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    histogram.totalNanos.store(histogram.totalNanos.load(memory_order_relaxed) + nanos, memory_order_relaxed);
+    if (nanos > histogram.maxNanos.load(memory_order_relaxed)) {
+        histogram.maxNanos.store(nanos, memory_order_relaxed);
+    }
+}
+
+/**
+ * Function: Record Load Phase
+ * Purpose: Stores the duration of one phase of the calling thread's current load
+ * Input: phase - load phase, nanos - measured duration
+ */
+void recordLoadPhase(LoadPhase phase, unsigned long long nanos) {
+    getThreadStats().phaseNanos[phase].store(nanos, memory_order_relaxed);
+}
+
+/**
+ * Function: Record Load Overlap
+ * Purpose: Marks the calling thread's current load as pipelined: its read and insert phases hold the
+ *          busy time of concurrent stages, so they may add up to more than the wall time
+ * Input: nanos - wall time of the pipeline
+ */
+void recordLoadOverlap(unsigned long long nanos) {
+    getThreadStats().overlappedNanos.store(nanos, memory_order_relaxed);
+}
+
+/**
+ * Function: Record Load Phase Memory
+ * Purpose: Stores the peak RSS of the phase that just ended and restarts peak tracking for the next one
+ * Input: phase - load phase (the total is the largest peak of the load)
+ */
+void recordLoadPhaseMemory(LoadPhase phase) {
+    ThreadStats& stats = getThreadStats();
+    unsigned long long peak = getPeakRssBytes();
+    if (phase == PHASE_TOTAL) {
+        for (int other = 0; other < PHASE_TOTAL; other++) {
+            peak = max(peak, stats.phasePeakRss[other].load(memory_order_relaxed));
+        }
+    }
+    stats.phasePeakRss[phase].store(peak, memory_order_relaxed);
+    stats.phasePeakRssReset.store(resetPeakRss(), memory_order_relaxed);
+}
+
+/**
+ * Function: Reset Load Phases
+ * Purpose: Clears the calling thread's phase timings and peaks before a load starts
+ */
+void resetLoadPhases() {
+    ThreadStats& stats = getThreadStats();
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        stats.phaseNanos[phase].store(0, memory_order_relaxed);
+        stats.phasePeakRss[phase].store(0, memory_order_relaxed);
+    }
+    stats.overlappedNanos.store(0, memory_order_relaxed);
+    stats.phasePeakRssReset.store(resetPeakRss(), memory_order_relaxed);
+}
+
+/**
+ * Function: Count Call
+ * Purpose: Counts one call of an operation and decides whether to time it
+ * Input: operation - instrumented operation, sampled - time only every LATENCY_SAMPLE_INTERVAL-th call
+ * Output: true if this call should be timed
+ */
+bool countCall(InstrumentedOperation operation, bool sampled) {
+    atomic<unsigned long long>& calls = getThreadStats().operations[operation].calls;
+    unsigned long long call = calls.load(memory_order_relaxed);
+    calls.store(call + 1, memory_order_relaxed);
+    return !sampled || call % LATENCY_SAMPLE_INTERVAL == 0;
+}
+
+/**
+ * Times the enclosing scope (every call, or one sampled call in LATENCY_SAMPLE_INTERVAL) and
+ * records it for an operation
+ */
+struct ScopedLatency {
+    InstrumentedOperation operation;          // Operation being timed
+    bool timed;                               // Whether this call was picked for timing
+    chrono::steady_clock::time_point start;   // Scope entry time
+
+    ScopedLatency(InstrumentedOperation op, bool sampled) : operation(op), timed(countCall(op, sampled)) {
+        if (timed) {
+            start = chrono::steady_clock::now();
+        }
+    }
+    ~ScopedLatency() {
+        if (timed) {
+            recordLatency(operation, (unsigned long long)chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now() - start).count());
+        }
+    }
+};
+
+/**
+ * Function: Elapsed Nanoseconds
+ * Purpose: Returns nanoseconds since a time point and restarts it (phase timer helper)
+ * Input: start - reference to the phase start, reset to now
+ * Output: Elapsed nanoseconds
+ */
+unsigned long long lapNanoseconds(chrono::steady_clock::time_point& start) {
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    unsigned long long nanos = (unsigned long long)chrono::duration_cast<chrono::nanoseconds>(now - start).count();
+    start = now;
+    return nanos;
+}
+
+#define INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_INNER(a, b)
+#define INSTRUMENT_SCOPE(operation) ScopedLatency INSTRUMENT_CONCAT(instrumentScope, __LINE__)(operation, false)
+#define INSTRUMENT_SAMPLED_SCOPE(operation) ScopedLatency INSTRUMENT_CONCAT(instrumentScope, __LINE__)(operation, true)
+#define INSTRUMENT_PHASE_START(timer) chrono::steady_clock::time_point timer = chrono::steady_clock::now()
+#define INSTRUMENT_PHASE_LAP(timer, phase) (recordLoadPhase(phase, lapNanoseconds(timer)), recordLoadPhaseMemory(phase))
+#define INSTRUMENT_PHASE_RECORD(phase, seconds) recordLoadPhase(phase, (unsigned long long)((seconds) * 1e9))
+#define INSTRUMENT_PHASE_MEMORY(phase) recordLoadPhaseMemory(phase)
+#define INSTRUMENT_PHASE_OVERLAP(seconds) recordLoadOverlap((unsigned long long)((seconds) * 1e9))
+#define INSTRUMENT_PHASES_RESET() resetLoadPhases()
+
+#else
+
+#define INSTRUMENT_SCOPE(operation)
+#define INSTRUMENT_SAMPLED_SCOPE(operation)
+#define INSTRUMENT_PHASE_START(timer)
+#define INSTRUMENT_PHASE_LAP(timer, phase)
+#define INSTRUMENT_PHASE_RECORD(phase, seconds)
+#define INSTRUMENT_PHASE_MEMORY(phase)
+#define INSTRUMENT_PHASE_OVERLAP(seconds)
+#define INSTRUMENT_PHASES_RESET()
+
+#endif
+
+/**
+ * Function: Open and Read File
+ * Purpose: Opens a file and reads all valid lines into a vector
+ * Input: filename - path to the course data file, lines - reference to vector that will store file lines,
+ *        lineNumbers - optional vector receiving the 1-based file line of each stored line
+ * Output: true if file was successfully read, false otherwise
+ */
+bool readFileLines(string filename, vector<string>& lines, vector<size_t>* lineNumbers = nullptr) {
+    INSTRUMENT_SCOPE(OP_READ_FILE);
+    ifstream file(filename);
+
+    if (!file.is_open()) {
+        cout << "Error: Cannot open file '" << filename << "'" << endl;
+        return false;
+    }
+
+    string line;
+    size_t lineNumber = 0;
+    while (getline(file, line)) {
+        lineNumber++;
+
+        // Check if line is not empty and not just whitespace
+        if (!line.empty()) {
+            // Simple whitespace check - if line has any non-space characters
+            bool hasContent = false;
+            for (char c : line) {
+                if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+                    hasContent = true;
+                    break;
+                }
+            }
+            if (hasContent) {
+                lines.push_back(line);
+                if (lineNumbers != nullptr) {
+                    lineNumbers->push_back(lineNumber);
+                }
+            }
+        }
+    }
+
+    file.close();
+
+    if (lines.size() == 0) {
+        cout << "Error: File is empty or contains no valid data" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Function: Parse Single Line
+ * Purpose: Splits a line by commas and cleans up tokens
+ * Input: line - raw line from file, tokens - reference to vector that will store parsed tokens
+ * Output: true if line was successfully parsed, false if malformed
+ */
+bool parseLine(string line, vector<string>& tokens) {
+    if (line.empty()) {
+        return false;
+    }
+
+    // Check if line is just whitespace
+    bool hasContent = false;
+    for (char c : line) {
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            hasContent = true;
+            break;
+        }
+    }
+    if (!hasContent) {
+        return false;
+    }
+
+    // Split line by comma into tokens
+    tokens.clear();
+    string token = "";
+
+    for (char c : line) {
+        if (c == ',') {
+            tokens.push_back(token);
+            token = "";
+        }
+        else {
+            token += c;
+        }
+    }
+    // Add the last token
+    tokens.push_back(token);
+
+    // Clean up tokens: trim whitespace and remove empty tokens
+    for (int i = tokens.size() - 1; i >= 0; i--) {
+        // Trim leading and trailing whitespace
+        string& t = tokens[i];
+        size_t start = t.find_first_not_of(" \t\r\n");
+        size_t end = t.find_last_not_of(" \t\r\n");
+
+        if (start != string::npos && end != string::npos) {
+            t = t.substr(start, end - start + 1);
+        }
+        else {
+            t = "";
+        }
+
+        // Remove empty tokens
+        if (t.empty()) {
+            tokens.erase(tokens.begin() + i);
+        }
+    }
+
+    return tokens.size() > 0;
+}
+
+/**
+ * Function: Validate Line Format
+ * Purpose: Ensures each line has minimum required fields
+ * Input: tokens - parsed line tokens, originalLine - for error reporting
+ * Output: true if line format is valid, false otherwise
+ */
+bool validateLineFormat(vector<string> tokens, string originalLine) {
+    if (tokens.size() < 2) {
+        cout << "Error: Line '" << originalLine << "' does not have minimum required parameters" << endl;
+        return false;
+    }
+
+    if (tokens[0].empty()) {
+        cout << "Error: Course number cannot be empty" << endl;
+        return false;
+    }
+
+    if (tokens[1].empty()) {
+        cout << "Error: Course name cannot be empty" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Function: Check if Course Exists
+ * Purpose: Searches for a course number in the file data
+ * Input: courseNumber - course to search for, allLines - all file lines
+ * Output: true if course exists, false otherwise
+ */
+bool courseExists(string courseNumber, vector<string> allLines) {
+    if (courseNumber.empty()) {
+        return false;
+    }
+
+    for (string line : allLines) {
+        vector<string> tokens;
+        if (parseLine(line, tokens) && tokens.size() >= 1) {
+            if (tokens[0] == courseNumber) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Function: Check All Prerequisites Exist
+ * Purpose: Validates that all prerequisites exist as courses in the file
+ * Input: allLines - all lines from the file
+ * Output: true if all prerequisites are valid, false otherwise
+ */
+bool validatePrerequisites(vector<string> allLines) {
+    for (string line : allLines) {
+        vector<string> tokens;
+        if (!parseLine(line, tokens)) {
+            continue; // Skip malformed lines
+        }
+
+        // Check prerequisites (tokens 2 and beyond)
+        if (tokens.size() > 2) { // has prerequisites
+            for (size_t i = 2; i < tokens.size(); i++) {
+                string prerequisite = tokens[i];
+                if (!prerequisite.empty() && !courseExists(prerequisite, allLines)) {
+                    cout << "Error: Prerequisite '" << prerequisite << "' in course '" << tokens[0] << "' does not exist as a course" << endl;
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Function: Validate Entire File
+ * Purpose: Orchestrates all file validation steps
+ * Input: lines - all lines read from file
+ * Output: true if entire file is valid, false if any validation fails
+ */
+bool validateFile(vector<string> lines) {
+    INSTRUMENT_SCOPE(OP_VALIDATE);
+    if (lines.size() == 0) {
+        cout << "Error: No valid lines found in file" << endl;
+        return false;
+    }
+
+    // Step 1: Check that all lines can be parsed and have valid format
+    for (string line : lines) {
+        vector<string> tokens;
+        if (!parseLine(line, tokens)) {
+            cout << "Error: Unable to parse line '" << line << "'" << endl;
+            return false;
+        }
+
+        if (!validateLineFormat(tokens, line)) {
+            return false;
+        }
+    }
+
+    // Step 2: Check that all prerequisites exist as courses
+    if (!validatePrerequisites(lines)) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Single problem found by the collect-all validator
+ */
+struct ValidationIssue {
+    string file;            // Catalog file (empty when a single file is validated)
+    size_t lineNumber = 0;  // 1-based line in the file
+    size_t column = 0;      // 1-based column of the offending field
+    string kind;            // "format", "duplicate", "dangling" or "cycle"
+    string message;         // Human-readable description
+};
+
+/**
+ * Files whose rows were concatenated for one validation pass;
+ * rows [firstRow[i], firstRow[i + 1]) came from names[i]
+ */
+struct RowSources {
+    vector<string> names;    // Catalog file of each group of rows, in load order
+    vector<size_t> firstRow; // Index of each file's first row
+};
+
+/**
+ * Course number and prerequisites of one line, with field columns for error reporting
+ */
+struct ParsedRow {
+    string courseNumber;                // First field (empty if the line has no fields)
+    size_t courseColumn = 1;            // Column of the first field
+    vector<string> prerequisites;       // Fields 3 and beyond
+    vector<size_t> prerequisiteColumns; // Column of each prerequisite
+    bool hasName = false;               // Line has at least two fields
+};
+
+/**
+ * Function: Run In Parallel
+ * Purpose: Splits [0, count) into contiguous chunks and runs one worker per chunk
+ * Input: count - number of items, threads - worker count (0 = hardware concurrency),
+ *        work - called as work(worker, begin, end) on its own thread
+ * Output: Returns after every worker has finished
+ */
+void runInParallel(size_t count, unsigned int threads, const function<void(unsigned int, size_t, size_t)>& work) {
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    if (count < threads) {
+        threads = max<unsigned int>(1u, (unsigned int)count);
+    }
+
+    vector<thread> workers;
+    size_t chunk = (count + threads - 1) / threads;
+    for (unsigned int worker = 0; worker < threads; worker++) {
+        size_t begin = min(count, worker * chunk);
+        size_t end = min(count, begin + chunk);
+        workers.push_back(thread(work, worker, begin, end));
+    }
+
+    for (thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * Function: Run Task Pool
+ * Purpose: Runs tasks of uneven cost on a fixed set of threads; each idle worker takes the next task
+ * Input: count - number of tasks, threads - worker count (0 = hardware concurrency),
+ *        task - called as task(index) once per index on some worker thread
+ * Output: Returns after every task has finished
+ */
+void runTaskPool(size_t count, unsigned int threads, const function<void(size_t)>& task) {
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    unsigned int workers = (unsigned int)min<size_t>(threads, max<size_t>(count, 1));
+
+    atomic<size_t> next(0);
+    runInParallel(workers, workers, [&](unsigned int, size_t, size_t) {
+        for (size_t index = next++; index < count; index = next++) {
+            task(index);
+        }
+    });
+}
+
+const size_t STREAM_BLOCK_BYTES = 1 << 20; // Bytes read per pipeline block (a longer line makes a longer block)
+const size_t STREAM_QUEUE_BLOCKS = 4;      // Blocks each pipeline queue holds before its producer waits
+const size_t STREAM_BYTES_PER_ROW_ESTIMATE = 64; // Typical catalog row size, for presizing per-course tables
+
+/**
+ * Bounded single-producer/single-consumer ring buffer joining two pipeline stages
+ * head and tail only grow; the consumer alone writes head and the producer alone writes
+ * tail, so neither side locks. A full queue makes the producer wait (backpressure)
+ */
+template <typename T>
+struct BoundedQueue {
+    vector<T> slots;               // Ring storage (capacity = slots.size())
+    atomic<size_t> head{ 0 };      // Next item to pop
+    atomic<size_t> tail{ 0 };      // Next slot to fill
+    atomic<bool> closed{ false };  // Producer pushed its last item
+    size_t fullWaits = 0;          // Pushes that found the queue full (producer side only)
+};
+
+/**
+ * Function: Pipeline Wait
+ * Purpose: Backs off while a pipeline stage waits on its neighbour: yields first, then sleeps briefly
+ * Input: spins - reference to the wait count of the current wait (start at 0)
+ */
+void pipelineWait(unsigned int& spins) {
+    if (++spins < 64) {
+        this_thread::yield();
+    }
+    else {
+        this_thread::sleep_for(chrono::microseconds(50));
+    }
+}
+
+/**
+ * Function: Queue Push
+ * Purpose: Moves an item into a bounded queue, waiting while the queue is full
+ * Input: queue - queue owned by this producer, item - item to move in
+ */
+template <typename T>
+void queuePush(BoundedQueue<T>& queue, T& item) {
+    size_t tail = queue.tail.load(memory_order_relaxed);
+    unsigned int spins = 0;
+    while (tail - queue.head.load(memory_order_acquire) == queue.slots.size()) {
+        pipelineWait(spins);
+    }
+    if (spins > 0) {
+        queue.fullWaits++;
+    }
+    queue.slots[tail % queue.slots.size()] = move(item);
+    queue.tail.store(tail + 1, memory_order_release);
+}
+
+/**
+ * Function: Queue Pop
+ * Purpose: Moves the oldest item out of a bounded queue, waiting while it is empty
+ * Input: queue - queue owned by this consumer, item - reference receiving the item
+ * Output: false once the queue is closed and drained
+ */
+template <typename T>
+bool queuePop(BoundedQueue<T>& queue, T& item) {
+    size_t head = queue.head.load(memory_order_relaxed);
+    unsigned int spins = 0;
+    while (head == queue.tail.load(memory_order_acquire)) {
+        // Items pushed before the close are visible once closed is
+        if (queue.closed.load(memory_order_acquire) && head == queue.tail.load(memory_order_acquire)) {
+            return false;
+        }
+        pipelineWait(spins);
+    }
+    item = move(queue.slots[head % queue.slots.size()]);
+    queue.head.store(head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Function: Queue Close
+ * Purpose: Marks that the producer will push nothing more
+ * Input: queue - queue owned by this producer
+ */
+template <typename T>
+void queueClose(BoundedQueue<T>& queue) {
+    queue.closed.store(true, memory_order_release);
+}
+
+/**
+ * Function: Parse Row With Columns
+ * Purpose: Splits a line exactly like parseLine but remembers where each field starts
+ * Input: line - raw line from file, row - reference to row to fill,
+ *        name - optional string receiving the course name (second field)
+ * Output: row holds the course number, prerequisites and their 1-based columns
+ */
+void parseRowWithColumns(const string& line, ParsedRow& row, string* name = nullptr) {
+    row = ParsedRow();
+    size_t fieldIndex = 0;
+    size_t start = 0;
+
+    while (start <= line.size()) {
+        size_t end = line.find(',', start);
+        if (end == string::npos) {
+            end = line.size();
+        }
+
+        // Trim the field the same way parseLine does; empty fields are dropped
+        size_t first = line.find_first_not_of(" \t\r\n", start);
+        if (first != string::npos && first < end) {
+            size_t last = line.find_last_not_of(" \t\r\n", end - 1);
+            string field = line.substr(first, last - first + 1);
+
+            if (fieldIndex == 0) {
+                row.courseNumber = field;
+                row.courseColumn = first + 1;
+            }
+            else if (fieldIndex == 1) {
+                row.hasName = true;
+                if (name != nullptr) {
+                    *name = field;
+                }
+            }
+            else {
+                row.prerequisites.push_back(field);
+                row.prerequisiteColumns.push_back(first + 1);
+            }
+            fieldIndex++;
+        }
+
+        start = end + 1;
+    }
+}
+
+/**
+ * Function: Get Row Source
+ * Purpose: Finds the catalog file a concatenated row came from
+ * Input: sources - file ranges (nullptr for a single file), row - row index
+ * Output: File name, or an empty string when there are no sources
+ */
+string getRowSource(const RowSources* sources, size_t row) {
+    if (sources == nullptr || sources->names.empty()) {
+        return "";
+    }
+    size_t file = upper_bound(sources->firstRow.begin(), sources->firstRow.end(), row) - sources->firstRow.begin();
+    return sources->names[file == 0 ? 0 : file - 1];
+}
+
+/**
+ * Function: Describe Row Location
+ * Purpose: Formats where a row is for messages that refer to another row
+ * Input: sources - file ranges (nullptr for a single file), lineNumbers - file line per row, row - row index
+ * Output: "line N" or "<file> line N"
+ */
+string describeRowLocation(const RowSources* sources, const vector<size_t>& lineNumbers, size_t row) {
+    string file = getRowSource(sources, row);
+    return (file.empty() ? "" : file + " ") + "line " + to_string(lineNumbers[row]);
+}
+
+/**
+ * Function: Make Validation Issue
+ * Purpose: Builds a ValidationIssue
+ * Input: lineNumber, column - location, kind - issue category, message - description,
+ *        file - catalog file (empty for a single file)
+ * Output: Populated issue
+ */
+ValidationIssue makeValidationIssue(size_t lineNumber, size_t column, const string& kind, const string& message,
+    const string& file = "") {
+    ValidationIssue issue;
+    issue.file = file;
+    issue.lineNumber = lineNumber;
+    issue.column = column;
+    issue.kind = kind;
+    issue.message = message;
+    return issue;
+}
+
+/**
+ * Function: Find Cycle Components
+ * Purpose: Finds every strongly connected group of nodes that forms a cycle (Tarjan, iterative)
+ * Input: nodeCount - number of nodes, edgeOffsets/edgeTargets - CSR adjacency,
+ *        onCycle - called once per cycle with its nodes in ascending order
+ */
+void findCycleComponents(size_t nodeCount, const vector<size_t>& edgeOffsets, const vector<size_t>& edgeTargets,
+    const function<void(const vector<size_t>&)>& onCycle) {
+    const size_t unvisited = (size_t)-1;
+    vector<size_t> order(nodeCount, unvisited);
+    vector<size_t> low(nodeCount, 0);
+    vector<bool> onStack(nodeCount, false);
+    vector<size_t> sccStack;
+    vector<pair<size_t, size_t>> callStack; // (node, next edge position)
+    size_t counter = 0;
+
+    for (size_t root = 0; root < nodeCount; root++) {
+        if (order[root] != unvisited || edgeOffsets[root] == edgeOffsets[root + 1]) {
+            continue;
+        }
+
+        callStack.push_back(make_pair(root, edgeOffsets[root]));
+        order[root] = low[root] = counter++;
+        sccStack.push_back(root);
+        onStack[root] = true;
+
+        while (!callStack.empty()) {
+            size_t node = callStack.back().first;
+            size_t& edge = callStack.back().second;
+
+            if (edge < edgeOffsets[node + 1]) {
+                size_t next = edgeTargets[edge++];
+                if (order[next] == unvisited) {
+                    order[next] = low[next] = counter++;
+                    sccStack.push_back(next);
+                    onStack[next] = true;
+                    callStack.push_back(make_pair(next, edgeOffsets[next]));
+                }
+                else if (onStack[next]) {
+                    low[node] = min(low[node], order[next]);
+                }
+                continue;
+            }
+
+            // Node finished: pop its component if it is the root of one
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                size_t parent = callStack.back().first;
+                low[parent] = min(low[parent], low[node]);
+            }
+            if (low[node] != order[node]) {
+                continue;
+            }
+
+            vector<size_t> component;
+            size_t member;
+            do {
+                member = sccStack.back();
+                sccStack.pop_back();
+                onStack[member] = false;
+                component.push_back(member);
+            } while (member != node);
+
+            bool selfLoop = false;
+            if (component.size() == 1) {
+                for (size_t e = edgeOffsets[node]; e < edgeOffsets[node + 1]; e++) {
+                    selfLoop = selfLoop || edgeTargets[e] == node;
+                }
+            }
+            if (component.size() == 1 && !selfLoop) {
+                continue;
+            }
+
+            sort(component.begin(), component.end());
+            onCycle(component);
+        }
+    }
+}
+
+/**
+ * Function: Build Prerequisite Graph
+ * Purpose: Turns (course, prerequisite) node pairs into compressed sparse row adjacency
+ * Input: edgeGroups - edges in any number of groups, nodeCount - number of nodes,
+ *        edgeOffsets, edgeTargets - references receiving the adjacency
+ */
+void buildPrerequisiteGraph(const vector<vector<pair<size_t, size_t>>>& edgeGroups, size_t nodeCount,
+    vector<size_t>& edgeOffsets, vector<size_t>& edgeTargets) {
+    edgeOffsets.assign(nodeCount + 1, 0);
+    for (const vector<pair<size_t, size_t>>& edges : edgeGroups) {
+        for (const pair<size_t, size_t>& edge : edges) {
+            edgeOffsets[edge.first + 1]++;
+        }
+    }
+    for (size_t i = 0; i < nodeCount; i++) {
+        edgeOffsets[i + 1] += edgeOffsets[i];
+    }
+    edgeTargets.assign(edgeOffsets.back(), 0);
+    vector<size_t> fill(edgeOffsets.begin(), edgeOffsets.end() - 1);
+    for (const vector<pair<size_t, size_t>>& edges : edgeGroups) {
+        for (const pair<size_t, size_t>& edge : edges) {
+            edgeTargets[fill[edge.first]++] = edge.second;
+        }
+    }
+}
+
+/**
+ * Function: Describe Prerequisite Cycle
+ * Purpose: Builds the message for one cycle, naming up to 10 courses
+ * Input: component - cycle nodes in ascending order, courseNumber - course number of a node
+ * Output: Message text
+ */
+string describePrerequisiteCycle(const vector<size_t>& component, const function<const string&(size_t)>& courseNumber) {
+    string message = "Prerequisite cycle among " + to_string(component.size()) + " course(s): ";
+    for (size_t i = 0; i < component.size() && i < 10; i++) {
+        message += (i > 0 ? ", " : "") + courseNumber(component[i]);
+    }
+    if (component.size() > 10) {
+        message += ", ...";
+    }
+    return message;
+}
+
+/**
+ * Function: Find Prerequisite Cycles
+ * Purpose: Reports every strongly connected group of courses, at the earliest line of the cycle
+ * Input: rowCount - number of rows (graph nodes), edgeOffsets/edgeTargets - CSR adjacency
+ *        from a course's first row to each prerequisite's first row, rows - parsed rows,
+ *        lineNumbers - file line per row, issues - reference to vector receiving one issue per cycle,
+ *        sources - file of each row when several catalogs were concatenated (nullptr for one file)
+ */
+void findPrerequisiteCycles(size_t rowCount, const vector<size_t>& edgeOffsets, const vector<size_t>& edgeTargets,
+    const vector<ParsedRow>& rows, const vector<size_t>& lineNumbers, vector<ValidationIssue>& issues,
+    const RowSources* sources = nullptr) {
+    findCycleComponents(rowCount, edgeOffsets, edgeTargets, [&](const vector<size_t>& component) {
+        string message = describePrerequisiteCycle(component, [&rows](size_t row) -> const string& {
+            return rows[row].courseNumber;
+        });
+        issues.push_back(makeValidationIssue(lineNumbers[component[0]], rows[component[0]].courseColumn,
+            "cycle", message, getRowSource(sources, component[0])));
+    });
+}
+
+/**
+ * Function: Validate File (Collect All Errors)
+ * Purpose: Checks every line in one parallel pass and reports every structural error,
+ *          duplicate course number, dangling prerequisite and prerequisite cycle
+ * Input: lines - lines read from file, lineNumbers - 1-based file line of each entry,
+ *        issues - reference to vector receiving every issue sorted by line and column,
+ *        threads - worker count (0 = hardware concurrency),
+ *        sources - file of each row when several catalogs were concatenated (nullptr for one file)
+ * Output: true if no format or dangling errors were found (duplicates and cycles are
+ *         reported but, as with validateFile, do not make the file invalid)
+ */
+bool validateFileCollectAll(const vector<string>& lines, const vector<size_t>& lineNumbers,
+    vector<ValidationIssue>& issues, unsigned int threads = 0, const RowSources* sources = nullptr) {
+    issues.clear();
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    const size_t shardCount = threads;
+    vector<ParsedRow> rows(lines.size());
+
+    // Pass 1: parse every line; partition rows into course-number shards
+    vector<vector<ValidationIssue>> workerIssues(threads);
+    vector<vector<vector<size_t>>> workerShards(threads, vector<vector<size_t>>(shardCount));
+    runInParallel(lines.size(), threads, [&](unsigned int worker, size_t begin, size_t end) {
+        hash<string> hasher;
+        for (size_t i = begin; i < end; i++) {
+            parseRowWithColumns(lines[i], rows[i]);
+            if (rows[i].courseNumber.empty()) {
+                workerIssues[worker].push_back(makeValidationIssue(lineNumbers[i], 1, "format",
+                    "Unable to parse line '" + lines[i] + "'", getRowSource(sources, i)));
+                continue;
+            }
+            if (!rows[i].hasName) {
+                workerIssues[worker].push_back(makeValidationIssue(lineNumbers[i], rows[i].courseColumn, "format",
+                    "Line '" + lines[i] + "' does not have minimum required parameters", getRowSource(sources, i)));
+            }
+            workerShards[worker][hasher(rows[i].courseNumber) % shardCount].push_back(i);
+        }
+    });
+
+    // Pass 2: one thread per shard finds the first row of each course and flags repeats
+    vector<unordered_map<string, size_t>> shards(shardCount);
+    vector<vector<ValidationIssue>> shardIssues(shardCount);
+    runInParallel(shardCount, (unsigned int)shardCount, [&](unsigned int, size_t begin, size_t end) {
+        for (size_t shard = begin; shard < end; shard++) {
+            // Workers own consecutive row ranges, so worker order keeps file order
+            for (unsigned int worker = 0; worker < threads; worker++) {
+                for (size_t row : workerShards[worker][shard]) {
+                    auto inserted = shards[shard].insert(make_pair(rows[row].courseNumber, row));
+                    if (!inserted.second) {
+                        shardIssues[shard].push_back(makeValidationIssue(lineNumbers[row], rows[row].courseColumn,
+                            "duplicate", "Course '" + rows[row].courseNumber + "' is already defined on "
+                            + describeRowLocation(sources, lineNumbers, inserted.first->second),
+                            getRowSource(sources, row)));
+                    }
+                }
+            }
+        }
+    });
+
+    // Pass 3: resolve prerequisites against the (now read-only) shards
+    vector<vector<pair<size_t, size_t>>> workerEdges(threads);
+    runInParallel(lines.size(), threads, [&](unsigned int worker, size_t begin, size_t end) {
+        hash<string> hasher;
+        for (size_t i = begin; i < end; i++) {
+            const ParsedRow& row = rows[i];
+            if (row.courseNumber.empty()) {
+                continue;
+            }
+            size_t from = shards[hasher(row.courseNumber) % shardCount].find(row.courseNumber)->second;
+
+            for (size_t p = 0; p < row.prerequisites.size(); p++) {
+                const string& prerequisite = row.prerequisites[p];
+                const unordered_map<string, size_t>& shard = shards[hasher(prerequisite) % shardCount];
+                auto found = shard.find(prerequisite);
+                if (found == shard.end()) {
+                    workerIssues[worker].push_back(makeValidationIssue(lineNumbers[i], row.prerequisiteColumns[p],
+                        "dangling", "Prerequisite '" + prerequisite + "' in course '" + row.courseNumber
+                        + "' does not exist as a course", getRowSource(sources, i)));
+                }
+                else {
+                    workerEdges[worker].push_back(make_pair(from, found->second));
+                }
+            }
+        }
+    });
+
+    // Pass 4: cycle detection over the prerequisite graph (compressed sparse row)
+    vector<size_t> edgeOffsets;
+    vector<size_t> edgeTargets;
+    buildPrerequisiteGraph(workerEdges, rows.size(), edgeOffsets, edgeTargets);
+    vector<vector<pair<size_t, size_t>>>().swap(workerEdges);
+
+    vector<ValidationIssue> cycleIssues;
+    findPrerequisiteCycles(rows.size(), edgeOffsets, edgeTargets, rows, lineNumbers, cycleIssues, sources);
+
+    // Merge and order every finding
+    bool valid = true;
+    issues.insert(issues.end(), cycleIssues.begin(), cycleIssues.end());
+    for (const vector<ValidationIssue>& group : workerIssues) {
+        issues.insert(issues.end(), group.begin(), group.end());
+    }
+    for (const vector<ValidationIssue>& group : shardIssues) {
+        issues.insert(issues.end(), group.begin(), group.end());
+    }
+    for (const ValidationIssue& issue : issues) {
+        if (issue.kind == "format" || issue.kind == "dangling") {
+            valid = false;
+        }
+    }
+
+    // Rows of a later file never sort before rows of an earlier one
+    size_t sourceCount = sources == nullptr ? 0 : sources->names.size();
+    unordered_map<string, size_t> fileOrder;
+    for (size_t i = 0; i < sourceCount; i++) {
+        fileOrder.insert(make_pair(sources->names[i], i));
+    }
+    sort(issues.begin(), issues.end(), [&fileOrder](const ValidationIssue& a, const ValidationIssue& b) {
+        if (a.file != b.file) {
+            return fileOrder[a.file] < fileOrder[b.file];
+        }
+        if (a.lineNumber != b.lineNumber) {
+            return a.lineNumber < b.lineNumber;
+        }
+        if (a.column != b.column) {
+            return a.column < b.column;
+        }
+        return a.message < b.message;
+    });
+
+    return valid;
+}
+
+/**
+ * Function: Print Validation Issues
+ * Purpose: Prints issues as "[file, ]Line L, column C: [kind] message"
+ * Input: issues - sorted issues, limit - maximum to print (0 = all)
+ */
+void printValidationIssues(const vector<ValidationIssue>& issues, size_t limit) {
+    for (size_t i = 0; i < issues.size() && (limit == 0 || i < limit); i++) {
+        const ValidationIssue& issue = issues[i];
+        cout << (issue.file.empty() ? "" : issue.file + ", ") << "Line " << issue.lineNumber << ", column " << issue.column << ": [" << issue.kind << "] "
+            << issue.message << endl;
+    }
+    if (limit > 0 && issues.size() > limit) {
+        cout << "... and " << (issues.size() - limit) << " more" << endl;
+    }
+}
+
+/**
+ * Function: Create Single Course Object
+ * Purpose: Creates a Course object from a validated line of data
+ * Input: line - validated line from file, course - reference to Course object to populate
+ * Output: true if course was created successfully, false otherwise
+ */
+bool createCourseObject(string line, Course& course) {
+    INSTRUMENT_SAMPLED_SCOPE(OP_PARSE);
+    vector<string> tokens;
+    if (!parseLine(line, tokens) || tokens.size() < 2) {
+        return false; // Invalid line format
+    }
+
+    // Set required fields
+    course.courseNumber = tokens[0];
+    course.name = tokens[1];
+    course.prerequisites.clear();
+
+    // Add prerequisites (tokens 2 and beyond)
+    for (size_t i = 2; i < tokens.size(); i++) {
+        if (!tokens[i].empty()) {
+            course.prerequisites.push_back(tokens[i]);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Function: Initialize Hash Table
+ * Purpose: Creates and initializes a new hash table with specified capacity
+ * Input: initialCapacity - starting number of buckets
+ * Output: Initialized HashTable structure
+ */
+HashTable initializeHashTable(int initialCapacity = 16) {
+    HashTable table;
+    table.capacity = initialCapacity;
+    table.size = 0;
+    table.maxLoadFactor = 0.7;
+
+    // Initialize all buckets to null
+    table.buckets.resize(initialCapacity);
+    for (int i = 0; i < initialCapacity; i++) {
+        table.buckets[i] = nullptr;
+    }
+
+    return table;
+}
+
+/**
+ * Function: Hash Function
+ * Purpose: Converts course number string to hash index using polynomial rolling hash
+ * Input: courseNumber - string to hash, capacity - table size for modulo
+ * Output: Hash index (0 to capacity-1)
+ */
+int hashFunction(string courseNumber, int capacity) {
+    if (courseNumber.empty()) {
+        return 0;
+    }
+
+    int hash = 0;
+    int prime = 31; // Common prime for polynomial hash
+
+    for (size_t i = 0; i < courseNumber.length(); i++) {
+        char c = courseNumber[i];
+        hash = hash * prime + (int)c;
+    }
+
+    // Ensure positive result and fit within table capacity
+    return abs(hash) % capacity;
+}
+
+/**
+ * Function: Calculate Load Factor
+ * Purpose: Determines current load factor for resize decisions
+ * Input: table - hash table to analyze
+ * Output: Current load factor (size/capacity ratio)
+ */
+double getLoadFactor(const HashTable& table) {
+    if (table.capacity == 0) {
+        return 0.0;
+    }
+    return (double)table.size / (double)table.capacity;
+}
+
+/**
+ * Function: Display Hash Table Statistics
+ * Purpose: Provides detailed statistics about hash table performance
+ * Input: table - hash table to analyze
+ * Output: Collision statistics, distribution analysis, performance metrics
+ */
+void displayHashTableStats(const HashTable& table) {
+    cout << "\n=== Hash Table Performance Statistics ===" << endl;
+    cout << "Total courses: " << table.size << endl;
+    cout << "Table capacity: " << table.capacity << endl;
+    cout << "Load factor: " << fixed << setprecision(3) << getLoadFactor(table) << endl;
+
+    // Analyze collision distribution
+    int emptyBuckets = 0;
+    int maxChainLength = 0;
+    int totalCollisions = 0;
+    int bucketsWithCollisions = 0;
+
+    for (int i = 0; i < table.capacity; i++) {
+        int chainLength = 0;
+        HashNode* current = table.buckets[i];
+
+        if (current == nullptr) {
+            emptyBuckets++;
+        }
+        else {
+            // Count chain length
+            while (current != nullptr) {
+                chainLength++;
+                current = current->next;
+            }
+
+            // Track collision statistics
+            if (chainLength > 1) {
+                totalCollisions += (chainLength - 1);
+                bucketsWithCollisions++;
+            }
+
+            if (chainLength > maxChainLength) {
+                maxChainLength = chainLength;
+            }
+        }
+    }
+
+    // Calculate percentages
+    double emptyPercentage = (emptyBuckets * 100.0) / table.capacity;
+    double collisionPercentage = (bucketsWithCollisions * 100.0) / table.capacity;
+
+    cout << "Empty buckets: " << emptyBuckets << " (" << fixed << setprecision(1)
+        << emptyPercentage << "%)" << endl;
+    cout << "Buckets with collisions: " << bucketsWithCollisions << " ("
+        << fixed << setprecision(1) << collisionPercentage << "%)" << endl;
+    cout << "Maximum chain length: " << maxChainLength << endl;
+    cout << "Total collisions: " << totalCollisions << endl;
+
+    // Calculate average search operations
+    if (table.size > 0) {
+        double avgSearchOps = (double)(table.size + totalCollisions) / table.size;
+        cout << "Average search operations: " << fixed << setprecision(2) << avgSearchOps << endl;
+    }
+
+    // Performance assessment
+    cout << "\nPerformance Assessment:" << endl;
+    if (getLoadFactor(table) <= 0.7) {
+        cout << "Load factor is optimal (<= 0.7)" << endl;
+    }
+    else {
+        cout << "Load factor is high (> 0.7) - consider resizing" << endl;
+    }
+
+    if (maxChainLength <= 3) {
+        cout << "Collision chains are manageable (<= 3)" << endl;
+    }
+    else {
+        cout << "Some collision chains are long (> 3)" << endl;
+    }
+
+    cout << "=========================================" << endl;
+}
+
+#ifndef PROJECTTWO_DISABLE_INSTRUMENTATION
+/**
+ * Merged view of one operation's histograms across all threads
+ */
+struct OperationSummary {
+    unsigned long long calls = 0;                    // Calls made
+    unsigned long long count = 0;                    // Number of samples
+    unsigned long long totalNanos = 0;               // Sum of all samples
+    unsigned long long maxNanos = 0;                 // Largest sample
+    vector<unsigned long long> buckets;              // Merged bucket counts
+};
+
+/**
+ * Function: Summarize Operation
+ * Purpose: Merges every thread's histogram for an operation
+ * Input: operation - instrumented operation, summary - reference to summary to fill
+ */
+void summarizeOperation(InstrumentedOperation operation, OperationSummary& summary) {
+    summary = OperationSummary();
+    summary.buckets.assign(HISTOGRAM_BUCKETS, 0);
+
+    StatsRegistry& registry = getStatsRegistry();
+    lock_guard<mutex> guard(registry.lock);
+    for (const unique_ptr<ThreadStats>& block : registry.blocks) {
+        const LatencyHistogram& histogram = block->operations[operation];
+        summary.calls += histogram.calls.load(memory_order_relaxed);
+        summary.count += histogram.count.load(memory_order_relaxed);
+        summary.totalNanos += histogram.totalNanos.load(memory_order_relaxed);
+        summary.maxNanos = max(summary.maxNanos, histogram.maxNanos.load(memory_order_relaxed));
+        for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+            summary.buckets[b] += histogram.buckets[b].load(memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Function: Histogram Percentile
+ * Purpose: Estimates a latency percentile from merged buckets
+ * Input: summary - merged histogram, percentile - value in [0, 100]
+ * Output: Upper bound of the bucket holding the percentile (nanoseconds), capped at the max
+ */
+unsigned long long histogramPercentile(const OperationSummary& summary, double percentile) {
+    if (summary.count == 0) {
+        return 0;
+    }
+
+    unsigned long long rank = (unsigned long long)ceil(percentile / 100.0 * summary.count);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    unsigned long long seen = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        seen += summary.buckets[b];
+        if (seen >= rank) {
+            return min(histogramBucketLimit(b), summary.maxNanos);
+        }
+    }
+    return summary.maxNanos;
+}
+#endif
+
+/**
+ * Function: Display Runtime Statistics
+ * Purpose: Prints latency percentiles for every instrumented operation and the
+ *          phase timings of the last load
+ * Output: Table of calls, mean, p50, p90, p99 and max in microseconds (sampled operations
+ *         take the latencies from their timed calls)
+ */
+void displayRuntimeStats() {
+#ifdef PROJECTTWO_DISABLE_INSTRUMENTATION
+    cout << "Runtime instrumentation is disabled in this build (PROJECTTWO_DISABLE_INSTRUMENTATION)." << endl;
+#else
+    cout << "\n=== Runtime Statistics (microseconds) ===" << endl;
+    cout << left << setw(24) << "Operation" << right << setw(10) << "calls" << setw(11) << "mean"
+        << setw(11) << "p50" << setw(11) << "p90" << setw(11) << "p99" << setw(12) << "max" << endl;
+
+    for (int op = 0; op < OP_COUNT; op++) {
+        OperationSummary summary;
+        summarizeOperation((InstrumentedOperation)op, summary);
+
+        double mean = summary.count > 0 ? (double)summary.totalNanos / summary.count : 0.0;
+        cout << left << setw(24) << OPERATION_NAMES[op] << right << setw(10) << summary.calls
+            << fixed << setprecision(2)
+            << setw(11) << mean / 1000.0
+            << setw(11) << histogramPercentile(summary, 50) / 1000.0
+            << setw(11) << histogramPercentile(summary, 90) / 1000.0
+            << setw(11) << histogramPercentile(summary, 99) / 1000.0
+            << setw(12) << summary.maxNanos / 1000.0 << endl;
+    }
+
+    cout << "\nLast load phases (milliseconds):";
+    ThreadStats& stats = getThreadStats();
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        cout << " " << PHASE_NAMES[phase] << "=" << fixed << setprecision(3)
+            << stats.phaseNanos[phase].load(memory_order_relaxed) / 1e6;
+    }
+    cout << endl;
+    unsigned long long overlapped = stats.overlappedNanos.load(memory_order_relaxed);
+    if (overlapped > 0) {
+        cout << "(Streamed load: read and insert are busy times of pipeline stages that overlapped in "
+            << overlapped / 1e6 << " ms of wall time, so together they can exceed it)" << endl;
+    }
+    cout << "=========================================" << endl;
+#endif
+}
+
+/**
+ * Function: Write Runtime Statistics
+ * Purpose: Dumps the runtime statistics as JSON for tooling
+ * Input: path - output file
+ * Output: true if the file was written
+ */
+bool writeRuntimeStatsJson(const string& path) {
+#ifdef PROJECTTWO_DISABLE_INSTRUMENTATION
+    (void)path;
+    return false;
+#else
+    ofstream file(path);
+    if (!file.is_open()) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+
+    file << "{\n  \"operations\": {\n";
+    for (int op = 0; op < OP_COUNT; op++) {
+        OperationSummary summary;
+        summarizeOperation((InstrumentedOperation)op, summary);
+
+        file << "    \"" << OPERATION_NAMES[op] << "\": {\"count\": " << summary.calls
+            << ", \"timed\": " << summary.count
+            << ", \"total_ns\": " << summary.totalNanos
+            << ", \"p50_ns\": " << histogramPercentile(summary, 50)
+            << ", \"p90_ns\": " << histogramPercentile(summary, 90)
+            << ", \"p99_ns\": " << histogramPercentile(summary, 99)
+            << ", \"p999_ns\": " << histogramPercentile(summary, 99.9)
+            << ", \"max_ns\": " << summary.maxNanos
+            << ", \"buckets\": [";
+
+        // Sparse bucket list: [upper bound ns, count]
+        bool first = true;
+        for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+            if (summary.buckets[b] > 0) {
+                file << (first ? "" : ", ") << "[" << histogramBucketLimit(b) << ", " << summary.buckets[b] << "]";
+                first = false;
+            }
+        }
+        file << "]}" << (op + 1 < OP_COUNT ? "," : "") << "\n";
+    }
+
+    file << "  },\n  \"last_load_phases_ns\": {";
+    ThreadStats& stats = getThreadStats();
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        file << (phase > 0 ? ", " : "") << "\"" << PHASE_NAMES[phase] << "\": "
+            << stats.phaseNanos[phase].load(memory_order_relaxed);
+    }
+    file << "},\n  \"last_load_overlapped_ns\": " << stats.overlappedNanos.load(memory_order_relaxed) << "\n}\n";
+    return true;
+#endif
+}
+
+/**
+ * Function: Resize Hash Table
+ * Purpose: Doubles table capacity and rehashes all existing courses
+ * Input: table - reference to hash table to resize
+ * Output: Updates table with new capacity and redistributed courses
+ */
+void resizeHashTable(HashTable& table) {
+    INSTRUMENT_SCOPE(OP_RESIZE);
+    // Store old buckets for rehashing
+    vector<HashNode*> oldBuckets = table.buckets;
+    int oldCapacity = table.capacity;
+
+    // Double the capacity
+    table.capacity = table.capacity * 2;
+    table.size = 0; // Will be recounted during rehashing
+
+    // Create new empty bucket array
+    table.buckets.clear();
+    table.buckets.resize(table.capacity);
+    for (int i = 0; i < table.capacity; i++) {
+        table.buckets[i] = nullptr;
+    }
+
+    // Rehash all existing courses into new table
+    for (int i = 0; i < oldCapacity; i++) {
+        HashNode* current = oldBuckets[i];
+        while (current != nullptr) {
+            HashNode* next = current->next; // Save next before reinsertion
+
+            // Calculate new hash index for the resized table
+            int newIndex = hashFunction(current->course.courseNumber, table.capacity);
+
+            // Insert directly into new table (no resize check needed)
+            current->next = table.buckets[newIndex];
+            table.buckets[newIndex] = current;
+            table.size++;
+
+            current = next;
+        }
+    }
+
+    if (table.verbose) {
+        cout << "Hash table resized from " << oldCapacity << " to " << table.capacity << " buckets" << endl;
+    }
+}
+
+/**
+ * Function: Check and Resize if Needed
+ * Purpose: Monitors load factor and triggers resize when necessary
+ * Input: table - reference to hash table to check
+ * Output: Resizes table if load factor > 0.7
+ */
+void checkAndResize(HashTable& table) {
+    if (getLoadFactor(table) > table.maxLoadFactor) {
+		resizeHashTable(table);
+    }
+}
+
+/**
+ * Function: Insert Course into Bucket
+ * Purpose: Chains a course into one bucket, replacing an existing course with the same number
+ * Input: table - reference to hash table, index - bucket for the course, course - Course object to insert
+ * Output: true if a new node was added (the caller updates table.size), false if a course was replaced
+ */
+bool insertCourseIntoBucket(HashTable& table, int index, const Course& course) {
+    // Create new node for the course
+    HashNode* newNode = new HashNode();
+    newNode->course = course;
+    newNode->next = nullptr;
+
+    // Handle collision using chaining
+    if (table.buckets[index] == nullptr) {
+        // No collision - first course in this bucket
+        table.buckets[index] = newNode;
+    }
+    else {
+        // Collision detected - check for duplicate course numbers first
+        HashNode* current = table.buckets[index];
+        while (current != nullptr) {
+            if (current->course.courseNumber == course.courseNumber) {
+                // Update existing course instead of creating duplicate
+                current->course = course;
+                delete newNode; // Clean up unused node
+                return false;
+            }
+            current = current->next;
+        }
+
+        // No duplicate found - add to front of chain
+        newNode->next = table.buckets[index];
+        table.buckets[index] = newNode;
+    }
+
+    return true;
+}
+
+/**
+ * Function: Insert Course into Hash Table
+ * Purpose: Adds a course to the hash table using chaining for collision resolution
+ * Input: table - reference to hash table, course - Course object to insert
+ * Output: Updates table with new course, handles collisions via chaining
+ */
+void insertCourseIntoTable(HashTable& table, Course course) {
+    INSTRUMENT_SAMPLED_SCOPE(OP_INSERT);
+    // Check if resize needed before insertion
+    checkAndResize(table);
+
+    // Calculate hash index for course
+    int index = hashFunction(course.courseNumber, table.capacity);
+
+    if (insertCourseIntoBucket(table, index, course)) {
+        table.size = table.size + 1;
+    }
+}
+
+/**
+ * Function: Remove Course from Hash Table
+ * Purpose: Unlinks and frees the node holding a course number
+ * Input: table - reference to hash table, courseNumber - course to remove
+ * Output: true if the course was found and removed, false otherwise
+ */
+bool removeCourseFromTable(HashTable& table, const string& courseNumber) {
+    if (courseNumber.empty() || table.capacity == 0) {
+        return false;
+    }
+
+    int index = hashFunction(courseNumber, table.capacity);
+
+    // Walk the chain keeping a pointer to the link that points at the current node
+    HashNode** link = &table.buckets[index];
+    while (*link != nullptr) {
+        if ((*link)->course.courseNumber == courseNumber) {
+            HashNode* removed = *link;
+            *link = removed->next;
+            delete removed;
+            table.size = table.size - 1;
+            return true;
+        }
+        link = &(*link)->next;
+    }
+
+    return false;
+}
+
+/**
+ * Function: Find Course in Hash Table
+ * Purpose: Looks a course up in place, without copying it
+ * Input: table - hash table to search, courseNumber - course to find
+ * Output: Pointer to the stored course (valid until the table changes), or nullptr
+ */
+const Course* findCourseInTable(const HashTable& table, const string& courseNumber) {
+    if (table.capacity == 0) {
+        return nullptr;
+    }
+    int index = hashFunction(courseNumber, table.capacity);
+    for (HashNode* current = table.buckets[index]; current != nullptr; current = current->next) {
+        if (current->course.courseNumber == courseNumber) {
+            return &current->course;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Collects all courses from the hash table into a vector for sorting
+ * Traverses all buckets and collision chains to gather every course
+ * @param table The hash table containing course data
+ * @return Vector containing all courses from the hash table
+ */
+vector<Course> collectAllCourses(const HashTable& table) {
+    vector<Course> allCourses;
+
+    // Traverse each bucket in the hash table
+    for (int i = 0; i < table.capacity; i++) {
+        HashNode* current = table.buckets[i];
+
+        // Traverse the collision chain at this bucket
+        while (current != nullptr) {
+            allCourses.push_back(current->course);
+            current = current->next;
+        }
+    }
+
+    return allCourses;
+}
+
+/**
+ * Merges two sorted subarrays into one sorted array
+ * @param courses Vector containing the subarrays
+ * @param left Start of first subarray
+ * @param middle End of first subarray (start of second is middle+1)
+ * @param right End of second subarray
+ */
+void merge(vector<Course>& courses, int left, int middle, int right) {
+    // Create temporary arrays for the two subarrays
+    vector<Course> leftArray;
+    vector<Course> rightArray;
+
+    // Copy data to temporary arrays
+    for (int i = left; i <= middle; i++) {
+        leftArray.push_back(courses[i]);
+    }
+
+    for (int j = middle + 1; j <= right; j++) {
+        rightArray.push_back(courses[j]);
+    }
+
+    // Merge the temporary arrays back into courses[left..right]
+    size_t i = 0;    // Initial index of first subarray
+    size_t j = 0;    // Initial index of second subarray
+    size_t k = left; // Initial index of merged subarray
+
+    while (i < leftArray.size() && j < rightArray.size()) {
+        // Compare course numbers for alphabetical ordering
+        if (leftArray[i].courseNumber <= rightArray[j].courseNumber) {
+            courses[k] = leftArray[i];
+            i++;
+        }
+        else {
+            courses[k] = rightArray[j];
+            j++;
+        }
+        k++;
+    }
+
+    // Copy remaining elements of leftArray, if any
+    while (i < leftArray.size()) {
+        courses[k] = leftArray[i];
+        i++;
+        k++;
+    }
+
+    // Copy remaining elements of rightArray, if any
+    while (j < rightArray.size()) {
+        courses[k] = rightArray[j];
+        j++;
+        k++;
+    }
+}
+
+/**
+ * Recursive merge sort implementation
+ * Divides the array into halves and recursively sorts each half
+ * @param courses Vector to sort
+ * @param left Starting index of the subarray
+ * @param right Ending index of the subarray
+ */
+void mergeSort(vector<Course>& courses, int left, int right) {
+    if (left < right) {
+        int middle = left + (right - left) / 2; // Avoid potential overflow
+
+        // Recursively sort first and second halves
+        mergeSort(courses, left, middle);
+        mergeSort(courses, middle + 1, right);
+
+        // Merge the sorted halves
+        merge(courses, left, middle, right);
+    }
+}
+
+/**
+ * Sorts a vector of courses alphanumerically by course number
+ * Uses merge sort algorithm for O(n log n) performance
+ * @param courses Vector of Course objects to sort (modified in place)
+ */
+void sortCoursesAlphanumerically(vector<Course>& courses) {
+    if (courses.size() <= 1) {
+        return; // Already sorted or empty
+    }
+
+    mergeSort(courses, 0, courses.size() - 1);
+}
+
+/**
+ * Function: Print Single Course Info
+ * Purpose: Displays basic course information in required format
+ * Input: course - Course object to display
+ * Output: Prints "courseNumber, courseName" to console
+ */
+void printCourseInfo(const Course& course) {
+    cout << course.courseNumber << ", " << course.name << endl;
+}
+
+/**
+ * Function: Print Paginated
+ * Purpose: Prints a course listing 10 entries per page, waiting for Enter between pages
+ * Input: count - number of entries, printEntry - prints entry i on one line
+ * Output: Listing with page headers and a total
+ */
+void printPaginated(size_t count, const function<void(size_t)>& printEntry) {
+    // Display the sorted course list with pagination
+    cout << "Here is a sample schedule:\n" << endl;
+
+    int pageSize = 10;
+    int currentPage = 1;
+    int totalPages = (count + pageSize - 1) / pageSize; // Ceiling division
+
+    for (size_t i = 0; i < count; i++) {
+        // Print page header at the start of each page
+        if (i % pageSize == 0) {
+            if (i > 0) {
+                // Add blank line before pagination prompt
+                cout << endl;
+                cout << "Press Enter to continue to page " << (currentPage + 1)
+                    << " of " << totalPages << "..." << endl;
+                cin.get(); // Wait for Enter key
+                cout << endl; // Add blank line after user input
+                currentPage++; // Move to next page after user input
+            }
+
+            if (totalPages > 1) {
+                cout << "--- Page " << currentPage << " of " << totalPages << " ---" << endl;
+                cout << endl; // Add blank line after page header
+            }
+        }
+
+        printEntry(i);
+    }
+
+    cout << "\nTotal courses displayed: " << count << endl;
+    cout << endl; // Add blank line for separation before menu redisplays
+}
+
+/**
+ * Function: Print All Courses Sorted with Pagination
+ * Purpose: Displays all courses from hash table in alphanumeric order with pagination
+ * Input: table - hash table containing courses
+ * Output: Displays all courses sorted by course number, 20 per page
+ */
+void printAllCoursesSorted(const HashTable& table) {
+    if (table.size == 0) {
+        cout << "No courses loaded. Please load data first using option 1." << endl;
+        return;
+    }
+
+    vector<Course> allCourses;
+    {
+        // Timed separately from printing so paging waits are not counted
+        INSTRUMENT_SCOPE(OP_LIST_SORTED);
+
+        // Collect all courses from hash table
+        allCourses = collectAllCourses(table);
+
+        // Sort the courses alphanumerically
+        sortCoursesAlphanumerically(allCourses);
+    }
+
+    printPaginated(allCourses.size(), [&allCourses](size_t i) {
+        printCourseInfo(allCourses[i]);
+    });
+}
+
+/**
+ * Function: Search Course in Hash Table
+ * Purpose: Efficiently finds a course using hash table lookup
+ * Input: table - hash table to search, courseNumber - course to find,
+ *        foundCourse - reference to Course object to populate if found
+ * Output: true if course found, false otherwise
+ * Complexity: Average O(1), worst case O(n) if many collisions
+ */
+bool searchCourse(const HashTable& table, const string& courseNumber, Course& foundCourse) {
+    INSTRUMENT_SAMPLED_SCOPE(OP_SEARCH);
+    if (courseNumber.empty()) {
+        return false;
+    }
+
+    // Calculate hash index
+    int index = hashFunction(courseNumber, table.capacity);
+
+    // Search through chain at this index
+    HashNode* current = table.buckets[index];
+
+    while (current != nullptr) {
+        if (current->course.courseNumber == courseNumber) {
+            foundCourse = current->course;
+            return true;
+        }
+        current = current->next;
+    }
+
+    return false; // Course not found
+}
+
+/**
+ * Function: Parse Term
+ * Purpose: Converts a term such as "Fall 2024" or "2025 spring" into an ordered term code
+ * Input: text - season (Winter, Spring, Summer, Fall) and four-digit year, any case, either order,
+ *        term - reference to the code (year * 4 + season, so Fall 2024 < Winter 2025 < Spring 2025)
+ * Output: true if the text names a term
+ */
+bool parseTerm(const string& text, int& term) {
+    string season = "";
+    string year = "";
+    for (char c : text) {
+        if (isalpha((unsigned char)c)) {
+            season += (char)tolower((unsigned char)c);
+        }
+        else if (isdigit((unsigned char)c)) {
+            year += c;
+        }
+        else if (c != ' ' && c != '-') {
+            return false;
+        }
+    }
+    if (year.size() != 4 || year[0] == '0') {
+        return false;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        string name = TERM_SEASONS[i];
+        transform(name.begin(), name.end(), name.begin(), ::tolower);
+        if (season == name) {
+            term = stoi(year) * 4 + i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Function: Format Term
+ * Purpose: Converts a term code back to text
+ * Input: term - code from parseTerm
+ * Output: Text such as "Fall 2024"
+ */
+string formatTerm(int term) {
+    return string(TERM_SEASONS[term % 4]) + " " + to_string(term / 4);
+}
+
+/**
+ * Function: Record Catalog Term
+ * Purpose: Adds the table's courses to the history as the catalog in effect from a term on
+ * Input: history - reference to catalog history, table - complete catalog for the term,
+ *        term - term code (must be later than every recorded term), changes - reference to counts to fill
+ * Output: true if recorded; unchanged courses keep their record, changed and new courses get a
+ *         record starting at term, and courses missing from the table have their record closed
+ */
+bool recordCatalogTerm(CatalogHistory& history, const HashTable& table, int term, TermChanges& changes) {
+    changes = TermChanges();
+    if (!history.terms.empty() && term <= history.terms.back()) {
+        cout << "Error: " << formatTerm(term) << " is not later than the latest recorded term, "
+            << formatTerm(history.terms.back()) << endl;
+        return false;
+    }
+
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            const Course& course = current->course;
+            vector<CourseVersion>& versions = history.versions[course.courseNumber];
+
+            if (!versions.empty() && versions.back().toTerm == TERM_OPEN) {
+                const Course& previous = versions.back().course;
+                if (previous.name == course.name && previous.prerequisites == course.prerequisites) {
+                    changes.unchanged++;
+                    continue;
+                }
+                versions.back().toTerm = term;
+                changes.changed++;
+            }
+            else {
+                changes.added++;
+            }
+
+            CourseVersion version;
+            version.course = course;
+            version.fromTerm = term;
+            versions.push_back(version);
+            history.records++;
+        }
+    }
+
+    // Open records the new catalog did not touch belong to withdrawn courses
+    for (auto& entry : history.versions) {
+        CourseVersion& latest = entry.second.back();
+        if (latest.toTerm != TERM_OPEN || latest.fromTerm == term) {
+            continue;
+        }
+
+        if (findCourseInTable(table, entry.first) == nullptr) {
+            latest.toTerm = term;
+            changes.withdrawn++;
+        }
+    }
+
+    history.terms.push_back(term);
+    return true;
+}
+
+/**
+ * Function: Find Course Version
+ * Purpose: Finds the record of a course in effect in a term
+ * Input: history - catalog history, courseNumber - course to find, asOfTerm - term code
+ * Output: Pointer to the record, or nullptr if the course was not in that term's catalog
+ * Complexity: Average O(1) to find the course plus O(log v) over its v records
+ */
+const CourseVersion* findCourseVersion(const CatalogHistory& history, const string& courseNumber, int asOfTerm) {
+    auto found = history.versions.find(courseNumber);
+    if (found == history.versions.end()) {
+        return nullptr;
+    }
+
+    // Last record starting at or before the term, if its range still covers the term
+    const vector<CourseVersion>& versions = found->second;
+    auto after = upper_bound(versions.begin(), versions.end(), asOfTerm, [](int term, const CourseVersion& version) {
+        return term < version.fromTerm;
+    });
+    if (after == versions.begin() || asOfTerm >= (after - 1)->toTerm) {
+        return nullptr;
+    }
+    return &*(after - 1);
+}
+
+/**
+ * Function: Search Course As Of Term
+ * Purpose: Finds a course as it was listed in a given term's catalog
+ * Input: history - catalog history, courseNumber - course to find, asOfTerm - term code,
+ *        foundCourse - reference to Course object to populate if found
+ * Output: true if the course was in that term's catalog, false otherwise
+ */
+bool searchCourse(const CatalogHistory& history, const string& courseNumber, int asOfTerm, Course& foundCourse) {
+    INSTRUMENT_SAMPLED_SCOPE(OP_SEARCH);
+    const CourseVersion* version = findCourseVersion(history, courseNumber, asOfTerm);
+    if (version == nullptr) {
+        return false;
+    }
+    foundCourse = version->course;
+    return true;
+}
+
+/**
+ * Function: Print Prerequisite List
+ * Purpose: Displays all prerequisites for a course, resolving each through a lookup
+ * Input: course - Course object whose prerequisites to display,
+ *        lookup - finds a prerequisite by course number
+ * Output: Prints prerequisite course information or "No prerequisites required"
+ */
+void printPrerequisiteList(const Course& course, const function<bool(const string&, Course&)>& lookup) {
+    if (course.prerequisites.size() == 0) {
+        cout << "No prerequisites required" << endl;
+        return;
+    }
+
+    cout << "Prerequisites: ";
+
+    for (size_t i = 0; i < course.prerequisites.size(); i++) {
+        Course prereqCourse;
+        if (lookup(course.prerequisites[i], prereqCourse)) {
+            cout << prereqCourse.courseNumber << ", " << prereqCourse.name;
+        }
+        else {
+            cout << "Warning: Prerequisite " << course.prerequisites[i] << " not found";
+        }
+
+        // Add comma separator between prerequisites (except for last one)
+        if (i < course.prerequisites.size() - 1) {
+            cout << "; ";
+        }
+    }
+
+    cout << endl;
+}
+
+/**
+ * Function: Print Prerequisites
+ * Purpose: Displays all prerequisites for a course using hash table lookups
+ * Input: course - Course object whose prerequisites to display,
+ *        table - hash table for prerequisite lookups
+ * Output: Prints prerequisite course information or "No prerequisites required"
+ */
+void printPrerequisites(const Course& course, const HashTable& table) {
+    printPrerequisiteList(course, [&table](const string& courseNumber, Course& found) {
+        return searchCourse(table, courseNumber, found);
+    });
+}
+
+/**
+ * Function: Print Prerequisites As Of Term
+ * Purpose: Displays a course's prerequisites as they were listed in a given term
+ * Input: course - Course object whose prerequisites to display, history - catalog history,
+ *        asOfTerm - term whose catalog supplies the prerequisite names
+ * Output: Prints prerequisite course information or "No prerequisites required"
+ */
+void printPrerequisites(const Course& course, const CatalogHistory& history, int asOfTerm) {
+    printPrerequisiteList(course, [&history, asOfTerm](const string& courseNumber, Course& found) {
+        return searchCourse(history, courseNumber, asOfTerm, found);
+    });
+}
+
+/**
+ * Function: Tokenize Course Name
+ * Purpose: Splits text into lowercase search terms (letters, digits, '+' and '#')
+ * Input: text - course name or query text, terms - reference to vector that will store the terms
+ * Output: terms contains every term in the order it appears in the text
+ */
+void tokenizeName(const string& text, vector<string>& terms) {
+    terms.clear();
+    string term = "";
+
+    for (char c : text) {
+        unsigned char uc = (unsigned char)c;
+        if (isalnum(uc) || c == '+' || c == '#') {
+            term += (char)tolower(uc);
+        }
+        else if (!term.empty()) {
+            terms.push_back(term);
+            term = "";
+        }
+    }
+
+    // Add the last term
+    if (!term.empty()) {
+        terms.push_back(term);
+    }
+}
+
+/**
+ * Function: Append Varint
+ * Purpose: Writes an unsigned value using 7 bits per byte (high bit = more bytes follow)
+ * Input: bytes - encoded byte stream, value - value to append
+ * Output: bytes grows by 1-5 bytes
+ */
+void appendVarint(vector<unsigned char>& bytes, unsigned int value) {
+    while (value >= 0x80) {
+        bytes.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back((unsigned char)value);
+}
+
+/**
+ * Function: Read Varint
+ * Purpose: Decodes one varint value and advances the read offset
+ * Input: bytes - encoded byte stream, offset - reference to current read position
+ * Output: Decoded value, offset moved past the encoded bytes
+ */
+unsigned int readVarint(const vector<unsigned char>& bytes, size_t& offset) {
+    unsigned int value = 0;
+    int shift = 0;
+
+    while (offset < bytes.size()) {
+        unsigned char b = bytes[offset++];
+        value |= (unsigned int)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            break;
+        }
+        shift += 7;
+    }
+
+    return value;
+}
+
+/**
+ * Function: Add Posting
+ * Purpose: Appends a document and its term positions to a compressed posting list
+ * Input: list - posting list to extend, docId - document id (must be ascending),
+ *        positions - ascending term positions within the course name
+ * Output: Posting list grows by one posting; a skip entry is added at each block start
+ */
+void addPosting(PostingList& list, int docId, const vector<int>& positions) {
+    if (list.docCount % POSTING_BLOCK_SIZE == 0) {
+        PostingSkip skip;
+        skip.firstDoc = docId;
+        skip.previousDoc = list.lastDoc;
+        skip.byteOffset = list.bytes.size();
+        list.skips.push_back(skip);
+    }
+
+    appendVarint(list.bytes, (unsigned int)(docId - list.lastDoc));
+    appendVarint(list.bytes, (unsigned int)positions.size());
+
+    int previousPosition = 0;
+    for (int position : positions) {
+        appendVarint(list.bytes, (unsigned int)(position - previousPosition));
+        previousPosition = position;
+    }
+
+    list.lastDoc = docId;
+    list.docCount++;
+}
+
+/**
+ * Function: Add Name Document
+ * Purpose: Tokenizes one course name and appends it as the next document id
+ * Input: index - reference to name index, course - course to add, terms - scratch vector for tokens
+ * Output: Posting lists of the name's terms grow by one posting; ranking totals include the course
+ */
+void addNameDocument(NameIndex& index, const Course& course, vector<string>& terms) {
+    int docId = (int)index.courseNumbers.size();
+    tokenizeName(course.name, terms);
+    index.courseNumbers.push_back(course.courseNumber);
+    index.nameLengths.push_back((int)terms.size());
+    index.removedDocs.push_back(false);
+    index.liveDocs++;
+    index.totalTerms += terms.size();
+
+    // Group positions per distinct term so each document is posted once per term
+    unordered_map<string, vector<int>> termPositions;
+    for (size_t position = 0; position < terms.size(); position++) {
+        termPositions[terms[position]].push_back((int)position);
+    }
+
+    for (auto& entry : termPositions) {
+        addPosting(index.terms[entry.first], docId, entry.second);
+    }
+    index.averageNameLength = (double)index.totalTerms / index.liveDocs;
+}
+
+/**
+ * Function: Build Name Index
+ * Purpose: Tokenizes every course name and builds compressed posting lists
+ * Input: table - hash table containing courses, index - reference to index to (re)build
+ * Output: index holds one posting list per distinct term; document ids follow course number order
+ */
+void buildNameIndex(const HashTable& table, NameIndex& index) {
+    index = NameIndex();
+
+    // Assign document ids in sorted order so results are stable between loads; sort node
+    // pointers rather than copies of every course
+    vector<const Course*> courses;
+    courses.reserve(table.size);
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            courses.push_back(&current->course);
+        }
+    }
+    sort(courses.begin(), courses.end(), [](const Course* a, const Course* b) {
+        return a->courseNumber < b->courseNumber;
+    });
+
+    index.courseNumbers.reserve(courses.size());
+    index.nameLengths.reserve(courses.size());
+    index.removedDocs.reserve(courses.size());
+    vector<string> terms;
+    for (const Course* course : courses) {
+        addNameDocument(index, *course, terms);
+    }
+    index.sortedDocs = courses.size();
+
+    // Release spare capacity left over from building
+    for (auto& entry : index.terms) {
+        entry.second.bytes.shrink_to_fit();
+        entry.second.skips.shrink_to_fit();
+    }
+}
+
+/**
+ * Function: Find Name Document
+ * Purpose: Finds the live document id of a course
+ * Input: index - name index, courseNumber - course to find
+ * Output: Document id, or -1 if the course is not indexed
+ * Complexity: O(log n) over the sorted documents plus a scan of the few added by edits
+ */
+int findNameDocument(const NameIndex& index, const string& courseNumber) {
+    auto sortedEnd = index.courseNumbers.begin() + index.sortedDocs;
+    auto found = lower_bound(index.courseNumbers.begin(), sortedEnd, courseNumber);
+    if (found != sortedEnd && *found == courseNumber && !index.removedDocs[found - index.courseNumbers.begin()]) {
+        return (int)(found - index.courseNumbers.begin());
+    }
+    for (size_t docId = index.sortedDocs; docId < index.courseNumbers.size(); docId++) {
+        if (!index.removedDocs[docId] && index.courseNumbers[docId] == courseNumber) {
+            return (int)docId;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Function: Update Name Index
+ * Purpose: Reflects one edited course in the index without rebuilding it: the old document is
+ *          marked removed and the current name, if any, is appended as a new document
+ * Input: table - hash table after the edit, index - reference to name index,
+ *        courseNumber - course that was added, updated or removed
+ * Output: index matches the table; it is rebuilt once edits make up an eighth of its documents
+ */
+void updateNameIndex(const HashTable& table, NameIndex& index, const string& courseNumber) {
+    int docId = findNameDocument(index, courseNumber);
+    if (docId >= 0) {
+        index.removedDocs[docId] = true;
+        index.liveDocs--;
+        index.totalTerms -= index.nameLengths[docId];
+        index.averageNameLength = index.liveDocs > 0 ? (double)index.totalTerms / index.liveDocs : 0.0;
+    }
+
+    const Course* course = findCourseInTable(table, courseNumber);
+    if (course != nullptr) {
+        vector<string> terms;
+        addNameDocument(index, *course, terms);
+    }
+
+    // Removed postings still cost a skip while searching, and added ids are out of order
+    size_t editedDocs = index.courseNumbers.size() - index.liveDocs + (index.courseNumbers.size() - index.sortedDocs);
+    if (editedDocs > max<size_t>(64, index.courseNumbers.size() / 8)) {
+        buildNameIndex(table, index);
+    }
+}
+
+/**
+ * Function: Get Name Index Size
+ * Purpose: Estimates the memory used by the name index
+ * Input: index - name index to measure
+ * Output: Approximate size in bytes (postings, skips, terms and document table)
+ */
+size_t getNameIndexBytes(const NameIndex& index) {
+    size_t bytes = 0;
+
+    for (const auto& entry : index.terms) {
+        bytes += entry.first.capacity() + sizeof(entry);
+        bytes += entry.second.bytes.capacity();
+        bytes += entry.second.skips.capacity() * sizeof(PostingSkip);
+    }
+
+    for (const string& courseNumber : index.courseNumbers) {
+        bytes += sizeof(string) + courseNumber.capacity();
+    }
+    bytes += index.nameLengths.capacity() * sizeof(int);
+    bytes += index.removedDocs.capacity() / 8;
+
+    return bytes;
+}
+
+/**
+ * Sequential reader over a compressed posting list
+ */
+struct PostingCursor {
+    const PostingList* list = nullptr; // Posting list being read
+    size_t offset = 0;                 // Byte offset of the next posting
+    int ordinal = -1;                  // Index of the current posting (-1 = before first)
+    int doc = -1;                      // Current document id
+    vector<int> positions;             // Term positions in the current document
+};
+
+/**
+ * Function: Open Posting Cursor
+ * Purpose: Positions a cursor before the first posting of a list
+ * Input: cursor - cursor to reset, list - posting list to read
+ */
+void openCursor(PostingCursor& cursor, const PostingList* list) {
+    cursor.list = list;
+    cursor.offset = 0;
+    cursor.ordinal = -1;
+    cursor.doc = -1;
+    cursor.positions.clear();
+}
+
+/**
+ * Function: Advance Posting Cursor
+ * Purpose: Decodes the next posting
+ * Input: cursor - cursor to advance
+ * Output: true if a posting was decoded, false if the list is exhausted
+ */
+bool cursorNext(PostingCursor& cursor) {
+    if (cursor.ordinal + 1 >= cursor.list->docCount) {
+        return false;
+    }
+
+    const vector<unsigned char>& bytes = cursor.list->bytes;
+    cursor.doc += (int)readVarint(bytes, cursor.offset);
+    cursor.ordinal++;
+
+    unsigned int frequency = readVarint(bytes, cursor.offset);
+    cursor.positions.resize(frequency);
+
+    int position = 0;
+    for (unsigned int i = 0; i < frequency; i++) {
+        position += (int)readVarint(bytes, cursor.offset);
+        cursor.positions[i] = position;
+    }
+
+    return true;
+}
+
+/**
+ * Function: Advance Cursor To Document
+ * Purpose: Moves the cursor to the first posting with doc >= target
+ * Input: cursor - cursor to advance, target - document id to reach
+ * Output: true if such a posting exists, false if the list is exhausted
+ * Complexity: Gallops over the skip table, then decodes at most one block
+ */
+bool cursorAdvanceTo(PostingCursor& cursor, int target) {
+    if (cursor.ordinal >= 0 && cursor.doc >= target) {
+        return true;
+    }
+
+    const vector<PostingSkip>& skips = cursor.list->skips;
+    int block = cursor.ordinal < 0 ? 0 : cursor.ordinal / POSTING_BLOCK_SIZE;
+
+    // Gallop forward to bracket the last block whose first document is <= target
+    int low = block;
+    int step = 1;
+    int high = block + step;
+    while (high < (int)skips.size() && skips[high].firstDoc <= target) {
+        low = high;
+        step *= 2;
+        high = block + step;
+    }
+    if (high > (int)skips.size()) {
+        high = (int)skips.size();
+    }
+
+    // Binary search inside the bracket
+    while (low + 1 < high) {
+        int middle = low + (high - low) / 2;
+        if (skips[middle].firstDoc <= target) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    // Jump to the block start only if it lies ahead of the cursor
+    int blockStart = low * POSTING_BLOCK_SIZE;
+    if (blockStart > cursor.ordinal) {
+        cursor.offset = skips[low].byteOffset;
+        cursor.doc = skips[low].previousDoc;
+        cursor.ordinal = blockStart - 1;
+    }
+
+    // Decode linearly within the block
+    while (cursorNext(cursor)) {
+        if (cursor.doc >= target) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Function: Score Term Match
+ * Purpose: Computes a BM25 relevance contribution for one term in one course name
+ * Input: index - name index, docId - matching document, frequency - term occurrences,
+ *        docCount - number of documents containing the term
+ * Output: Score contribution (higher for rarer terms and shorter names)
+ */
+double scoreTerm(const NameIndex& index, int docId, int frequency, int docCount) {
+    const double k1 = 1.2;
+    const double b = 0.75;
+
+    double total = (double)index.liveDocs;
+    double idf = log(1.0 + (total - docCount + 0.5) / (docCount + 0.5));
+    double lengthRatio = index.averageNameLength > 0.0 ? index.nameLengths[docId] / index.averageNameLength : 1.0;
+
+    return idf * (frequency * (k1 + 1.0)) / (frequency + k1 * (1.0 - b + b * lengthRatio));
+}
+
+/**
+ * Function: Intersect Terms
+ * Purpose: Finds courses whose names contain all terms (optionally as an exact phrase)
+ * Input: index - name index, terms - query terms in order, phrase - require adjacent positions,
+ *        matches - reference to vector that will store matches in ascending document order
+ * Output: matches holds every matching document with its score
+ */
+void intersectTerms(const NameIndex& index, const vector<string>& terms, bool phrase, vector<NameMatch>& matches) {
+    matches.clear();
+    if (terms.empty()) {
+        return;
+    }
+
+    // Open one cursor per term; a missing term means nothing can match
+    vector<PostingCursor> cursors(terms.size());
+    for (size_t i = 0; i < terms.size(); i++) {
+        auto found = index.terms.find(terms[i]);
+        if (found == index.terms.end()) {
+            return;
+        }
+        openCursor(cursors[i], &found->second);
+    }
+
+    // Drive the intersection from the shortest list
+    vector<size_t> order(terms.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    sort(order.begin(), order.end(), [&cursors](size_t a, size_t b) {
+        return cursors[a].list->docCount < cursors[b].list->docCount;
+    });
+
+    PostingCursor& lead = cursors[order[0]];
+    if (!cursorNext(lead)) {
+        return;
+    }
+
+    int candidate = lead.doc;
+    size_t k = 1;
+
+    while (true) {
+        if (k == order.size()) {
+            // All cursors agree on the candidate document
+            bool accepted = true;
+            if (phrase) {
+                accepted = false;
+                for (int start : cursors[0].positions) {
+                    bool adjacent = true;
+                    for (size_t i = 1; i < cursors.size() && adjacent; i++) {
+                        adjacent = binary_search(cursors[i].positions.begin(), cursors[i].positions.end(), start + (int)i);
+                    }
+                    if (adjacent) {
+                        accepted = true;
+                        break;
+                    }
+                }
+            }
+
+            if (accepted && !index.removedDocs[candidate]) {
+                NameMatch match;
+                match.docId = candidate;
+                for (const PostingCursor& cursor : cursors) {
+                    match.score += scoreTerm(index, candidate, (int)cursor.positions.size(), cursor.list->docCount);
+                }
+                matches.push_back(match);
+            }
+
+            if (!cursorNext(lead)) {
+                break;
+            }
+            candidate = lead.doc;
+            k = 1;
+            continue;
+        }
+
+        PostingCursor& cursor = cursors[order[k]];
+        if (!cursorAdvanceTo(cursor, candidate)) {
+            break;
+        }
+
+        if (cursor.doc == candidate) {
+            k++;
+            continue;
+        }
+
+        // Another list skipped past the candidate - move the leader up to it
+        if (!cursorAdvanceTo(lead, cursor.doc)) {
+            break;
+        }
+        candidate = lead.doc;
+        k = 1;
+    }
+}
+
+/**
+ * Function: Intersect Match Lists
+ * Purpose: Keeps documents present in both lists and adds their scores
+ * Input: left, right - matches in ascending document order
+ * Output: Matches present in both lists, ascending document order
+ */
+vector<NameMatch> intersectMatches(const vector<NameMatch>& left, const vector<NameMatch>& right) {
+    vector<NameMatch> result;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < left.size() && j < right.size()) {
+        if (left[i].docId < right[j].docId) {
+            i++;
+        }
+        else if (left[i].docId > right[j].docId) {
+            j++;
+        }
+        else {
+            NameMatch match = left[i];
+            match.score += right[j].score;
+            result.push_back(match);
+            i++;
+            j++;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Function: Union Match Lists
+ * Purpose: Merges two match lists, adding scores of documents present in both
+ * Input: left, right - matches in ascending document order
+ * Output: Matches present in either list, ascending document order
+ */
+vector<NameMatch> unionMatches(const vector<NameMatch>& left, const vector<NameMatch>& right) {
+    vector<NameMatch> result;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < left.size() || j < right.size()) {
+        if (j == right.size() || (i < left.size() && left[i].docId < right[j].docId)) {
+            result.push_back(left[i++]);
+        }
+        else if (i == left.size() || right[j].docId < left[i].docId) {
+            result.push_back(right[j++]);
+        }
+        else {
+            NameMatch match = left[i++];
+            match.score += right[j++].score;
+            result.push_back(match);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Function: Evaluate Query Clause
+ * Purpose: Evaluates an AND clause made of loose terms and quoted phrases
+ * Input: index - name index, looseTerms - terms that must all appear anywhere,
+ *        phrases - term sequences that must appear adjacently
+ * Output: Matches for the clause in ascending document order
+ */
+vector<NameMatch> evaluateClause(const NameIndex& index, const vector<string>& looseTerms,
+    const vector<vector<string>>& phrases) {
+    vector<NameMatch> result;
+    bool first = true;
+
+    if (!looseTerms.empty()) {
+        intersectTerms(index, looseTerms, false, result);
+        first = false;
+    }
+
+    for (const vector<string>& phrase : phrases) {
+        vector<NameMatch> phraseMatches;
+        intersectTerms(index, phrase, true, phraseMatches);
+        result = first ? phraseMatches : intersectMatches(result, phraseMatches);
+        first = false;
+    }
+
+    return result;
+}
+
+/**
+ * Function: Search Course Names
+ * Purpose: Runs a keyword query against the name index
+ * Input: index - name index, query - terms are ANDed, "quoted text" is a phrase,
+ *        OR separates alternatives, matches - reference to vector that will store ranked results
+ * Output: true if the query contained at least one term; matches sorted best first
+ */
+bool searchCourseNames(const NameIndex& index, const string& query, vector<NameMatch>& matches) {
+    matches.clear();
+
+    vector<string> looseTerms;
+    vector<vector<string>> phrases;
+    vector<NameMatch> combined;
+    bool hasTerms = false;
+
+    size_t i = 0;
+    while (i <= query.size()) {
+        // Quoted phrase
+        if (i < query.size() && query[i] == '"') {
+            size_t close = query.find('"', i + 1);
+            if (close == string::npos) {
+                close = query.size();
+            }
+
+            vector<string> phraseTerms;
+            tokenizeName(query.substr(i + 1, close - i - 1), phraseTerms);
+            if (phraseTerms.size() == 1) {
+                looseTerms.push_back(phraseTerms[0]);
+            }
+            else if (!phraseTerms.empty()) {
+                phrases.push_back(phraseTerms);
+            }
+
+            i = close + 1;
+            continue;
+        }
+
+        // Bare word up to the next space or quote
+        size_t end = i;
+        while (end < query.size() && query[end] != ' ' && query[end] != '\t' && query[end] != '"') {
+            end++;
+        }
+        string word = query.substr(i, end - i);
+
+        bool isOperator = (word == "OR" || word == "|" || word == "AND");
+        if (!isOperator) {
+            vector<string> wordTerms;
+            tokenizeName(word, wordTerms);
+            looseTerms.insert(looseTerms.end(), wordTerms.begin(), wordTerms.end());
+        }
+
+        // Close the current clause at OR or at the end of the query
+        bool clauseEnds = (word == "OR" || word == "|" || end >= query.size());
+        if (clauseEnds && (!looseTerms.empty() || !phrases.empty())) {
+            combined = unionMatches(combined, evaluateClause(index, looseTerms, phrases));
+            looseTerms.clear();
+            phrases.clear();
+            hasTerms = true;
+        }
+
+        // Leave a following quote in place so the phrase branch handles it
+        i = (end < query.size() && query[end] == '"') ? end : end + 1;
+    }
+
+    // Rank by score, ties broken by course number order (ids added by edits are not in that order)
+    matches = combined;
+    sort(matches.begin(), matches.end(), [&index](const NameMatch& a, const NameMatch& b) {
+        if (a.score != b.score) {
+            return a.score > b.score;
+        }
+        return index.courseNumbers[a.docId] < index.courseNumbers[b.docId];
+    });
+
+    return hasTerms;
+}
+
+/**
+ * Function: Hash Deletion Variants
+ * Purpose: Hashes (FNV-1a) every variant of a word obtained by deleting up to maxDistance
+ *          characters, without building the variant strings
+ * Input: word - original string, maxDistance - maximum characters to delete,
+ *        skipped - positions already deleted (ascending), firstPosition - smallest position
+ *        that may be deleted next, hashes - reference to vector that receives the hashes
+ * Output: hashes grows by one entry per variant (callers sort and deduplicate)
+ */
+void hashDeletes(const string& word, int maxDistance, vector<size_t>& skipped, size_t firstPosition,
+    vector<unsigned int>& hashes) {
+    // Hash the variant with the current set of deleted positions
+    unsigned int hash = 2166136261u;
+    size_t nextSkip = 0;
+    for (size_t i = 0; i < word.size(); i++) {
+        if (nextSkip < skipped.size() && skipped[nextSkip] == i) {
+            nextSkip++;
+            continue;
+        }
+        hash ^= (unsigned char)word[i];
+        hash *= 16777619u;
+    }
+    hashes.push_back(hash);
+
+    if ((int)skipped.size() == maxDistance) {
+        return;
+    }
+
+    // Delete one more character after the last deleted position
+    for (size_t i = firstPosition; i < word.size(); i++) {
+        skipped.push_back(i);
+        hashDeletes(word, maxDistance, skipped, i + 1, hashes);
+        skipped.pop_back();
+    }
+}
+
+/**
+ * Function: Generate Deletion Variant Hashes
+ * Purpose: Lists the distinct hashes of every variant within maxDistance deletions
+ * Input: word - original string, maxDistance - maximum characters to delete,
+ *        hashes - reference to vector that will store the hashes (including word itself)
+ * Output: hashes sorted and deduplicated
+ */
+void generateDeleteHashes(const string& word, int maxDistance, vector<unsigned int>& hashes) {
+    hashes.clear();
+    vector<size_t> skipped;
+    hashDeletes(word, maxDistance, skipped, 0, hashes);
+
+    sort(hashes.begin(), hashes.end());
+    hashes.erase(unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+/**
+ * Function: Suggestion Bucket
+ * Purpose: Returns the directory bucket of a variant hash
+ * Input: index - suggestion index, hash - variant hash
+ */
+unsigned int suggestionBucket(const SuggestionIndex& index, unsigned int hash) {
+    return index.directoryBits == 0 ? 0 : hash >> (32 - index.directoryBits);
+}
+
+/**
+ * Function: Suggestion Tag
+ * Purpose: Returns the hash bits an entry keeps: those below the bucket bits, in the entry bits above the code id
+ * Input: index - suggestion index, hash - variant hash
+ */
+unsigned int suggestionTag(const SuggestionIndex& index, unsigned int hash) {
+    return (hash << index.directoryBits) & ~index.idMask;
+}
+
+/**
+ * Function: Build Suggestion Index
+ * Purpose: Builds the deletion index over every course number in the table
+ * Input: table - hash table containing courses, index - reference to index to (re)build
+ * Output: index holds every deletion variant, bucketed by hash and sorted within each bucket
+ */
+void buildSuggestionIndex(const HashTable& table, SuggestionIndex& index) {
+    index = SuggestionIndex();
+    index.codes.reserve(table.size);
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            index.codes.push_back(current->course.courseNumber);
+        }
+    }
+
+    // (hash, code id) pairs sort by hash; each becomes one 32-bit entry below
+    vector<unsigned long long> deletes;
+    vector<unsigned int> hashes;
+    for (size_t id = 0; id < index.codes.size(); id++) {
+        generateDeleteHashes(index.codes[id], SUGGESTION_MAX_DISTANCE, hashes);
+        for (unsigned int hash : hashes) {
+            deletes.push_back((unsigned long long)hash << 32 | id);
+        }
+    }
+    sort(deletes.begin(), deletes.end());
+
+    // The code id takes as few bits as the code count needs; the bucket and tag keep the rest of the hash
+    int idBits = 1;
+    while (idBits < 32 && (index.codes.size() - 1) >> idBits != 0) {
+        idBits++;
+    }
+    index.idMask = idBits == 32 ? 0xFFFFFFFFu : (1u << idBits) - 1;
+    while (index.directoryBits < SUGGESTION_MAX_DIRECTORY_BITS
+        && deletes.size() >> index.directoryBits > SUGGESTION_BUCKET_ENTRIES) {
+        index.directoryBits++;
+    }
+
+    index.directory.assign(((size_t)1 << index.directoryBits) + 1, 0);
+    index.entries.resize(deletes.size());
+    for (size_t i = 0; i < deletes.size(); i++) {
+        unsigned int hash = (unsigned int)(deletes[i] >> 32);
+        index.entries[i] = suggestionTag(index, hash) | (unsigned int)deletes[i];
+        index.directory[suggestionBucket(index, hash) + 1]++;
+    }
+    for (size_t bucket = 1; bucket < index.directory.size(); bucket++) {
+        index.directory[bucket] += index.directory[bucket - 1];
+    }
+}
+
+/**
+ * Function: Bounded Edit Distance
+ * Purpose: Computes the optimal string alignment distance (insert, delete,
+ *          substitute, transpose adjacent) between two strings
+ * Input: a, b - strings to compare, maxDistance - largest distance of interest
+ * Output: Distance, or maxDistance + 1 once the distance is known to exceed maxDistance
+ */
+int editDistance(const string& a, const string& b, int maxDistance) {
+    int lengthA = (int)a.size();
+    int lengthB = (int)b.size();
+    if (abs(lengthA - lengthB) > maxDistance) {
+        return maxDistance + 1;
+    }
+
+    // Three rolling rows are enough for transpositions
+    vector<int> previous2(lengthB + 1);
+    vector<int> previous(lengthB + 1);
+    vector<int> current(lengthB + 1);
+    for (int j = 0; j <= lengthB; j++) {
+        previous[j] = j;
+    }
+
+    for (int i = 1; i <= lengthA; i++) {
+        current[0] = i;
+        int rowMinimum = current[0];
+
+        for (int j = 1; j <= lengthB; j++) {
+            int cost = (a[i - 1] == b[j - 1]) ? 0 : 1;
+            current[j] = min(min(previous[j] + 1, current[j - 1] + 1), previous[j - 1] + cost);
+
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+                current[j] = min(current[j], previous2[j - 2] + 1);
+            }
+            rowMinimum = min(rowMinimum, current[j]);
+        }
+
+        // Every path through this row already exceeds the bound
+        if (rowMinimum > maxDistance) {
+            return maxDistance + 1;
+        }
+
+        previous2.swap(previous);
+        previous.swap(current);
+    }
+
+    return min(previous[lengthB], maxDistance + 1);
+}
+
+/**
+ * Function: Suggest Course Numbers
+ * Purpose: Finds the nearest course numbers to a missed lookup
+ * Input: index - suggestion index, query - course number that was not found,
+ *        count - maximum suggestions, suggestions - reference to vector that will store results
+ * Output: suggestions sorted by edit distance then course number, all within SUGGESTION_MAX_DISTANCE
+ */
+void suggestCourses(const SuggestionIndex& index, const string& query, size_t count, vector<string>& suggestions) {
+    suggestions.clear();
+    if (query.empty() || index.codes.empty()) {
+        return;
+    }
+
+    // Any code within the bound shares at least one deletion variant with the query
+    vector<unsigned int> hashes;
+    generateDeleteHashes(query, SUGGESTION_MAX_DISTANCE, hashes);
+
+    vector<unsigned int> candidates;
+    for (unsigned int hash : hashes) {
+        unsigned int bucket = suggestionBucket(index, hash);
+        unsigned int tag = suggestionTag(index, hash);
+        for (unsigned int i = index.directory[bucket]; i < index.directory[bucket + 1]; i++) {
+            // Entries in a bucket are sorted by tag
+            unsigned int entryTag = index.entries[i] & ~index.idMask;
+            if (entryTag > tag) {
+                break;
+            }
+            if (entryTag == tag) {
+                candidates.push_back(index.entries[i] & index.idMask);
+            }
+        }
+    }
+
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // Verify candidates (hash collisions and over-counted deletions are filtered here)
+    vector<pair<int, string>> ranked;
+    for (unsigned int id : candidates) {
+        int distance = editDistance(query, index.codes[id], SUGGESTION_MAX_DISTANCE);
+        if (distance <= SUGGESTION_MAX_DISTANCE) {
+            ranked.push_back(make_pair(distance, index.codes[id]));
+        }
+    }
+
+    sort(ranked.begin(), ranked.end());
+    for (size_t i = 0; i < ranked.size() && i < count; i++) {
+        suggestions.push_back(ranked[i].second);
+    }
+}
+
+/**
+ * Function: Build Dependency Index
+ * Purpose: Inverts every prerequisite edge so dependents can be found without scanning the table
+ * Input: table - hash table containing courses, index - reference to index to (re)build
+ * Output: index holds sorted dependents per course; the impact cache is cleared
+ */
+void buildDependencyIndex(const HashTable& table, DependencyIndex& index) {
+    index.codes.clear();
+    index.ids.clear();
+    index.dependentOffsets.clear();
+    index.dependents.clear();
+    index.impactCache.clear();
+
+    // Number courses in sorted order so dependents print alphanumerically
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            index.codes.push_back(current->course.courseNumber);
+        }
+    }
+    sort(index.codes.begin(), index.codes.end());
+
+    index.ids.reserve(index.codes.size());
+    for (size_t id = 0; id < index.codes.size(); id++) {
+        index.ids[index.codes[id]] = (int)id;
+    }
+
+    // Collect (prerequisite, dependent) edges; unknown prerequisites are ignored
+    vector<pair<int, int>> edges;
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            int dependent = index.ids[current->course.courseNumber];
+            for (const string& prerequisite : current->course.prerequisites) {
+                auto found = index.ids.find(prerequisite);
+                if (found != index.ids.end()) {
+                    edges.push_back(make_pair(found->second, dependent));
+                }
+            }
+        }
+    }
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+
+    // Lay the edges out in compressed sparse row form
+    index.dependentOffsets.assign(index.codes.size() + 1, 0);
+    index.dependents.reserve(edges.size());
+    for (const pair<int, int>& edge : edges) {
+        index.dependentOffsets[edge.first + 1]++;
+        index.dependents.push_back(edge.second);
+    }
+    for (size_t id = 0; id < index.codes.size(); id++) {
+        index.dependentOffsets[id + 1] += index.dependentOffsets[id];
+    }
+}
+
+/**
+ * Function: Get Direct Dependents
+ * Purpose: Lists the courses that name a course as a direct prerequisite
+ * Input: index - dependency index, courseNumber - prerequisite course,
+ *        dependents - reference to vector that will store the course numbers
+ * Output: true if the course is known, false otherwise; dependents sorted alphanumerically
+ */
+bool getDirectDependents(const DependencyIndex& index, const string& courseNumber, vector<string>& dependents) {
+    dependents.clear();
+
+    auto found = index.ids.find(courseNumber);
+    if (found == index.ids.end()) {
+        return false;
+    }
+
+    int id = found->second;
+    for (int i = index.dependentOffsets[id]; i < index.dependentOffsets[id + 1]; i++) {
+        dependents.push_back(index.codes[index.dependents[i]]);
+    }
+
+    return true;
+}
+
+/**
+ * Function: Get Impact Set
+ * Purpose: Lists every course that directly or transitively requires a course
+ *          (the courses affected if it is retired or renumbered)
+ * Input: index - dependency index (the result is memoized in it),
+ *        courseNumber - prerequisite course, impacted - reference to vector that will store the course numbers
+ * Output: true if the course is known, false otherwise; impacted sorted alphanumerically
+ */
+bool getImpactSet(DependencyIndex& index, const string& courseNumber, vector<string>& impacted) {
+    impacted.clear();
+
+    auto found = index.ids.find(courseNumber);
+    if (found == index.ids.end()) {
+        return false;
+    }
+
+    int start = found->second;
+    auto cached = index.impactCache.find(start);
+
+    if (cached == index.impactCache.end()) {
+        // Breadth-first walk over dependents; visited marks also stop cycles
+        vector<int> reached;
+        vector<bool> visited(index.codes.size(), false);
+        vector<int> queue;
+        queue.push_back(start);
+        visited[start] = true;
+
+        for (size_t head = 0; head < queue.size(); head++) {
+            int id = queue[head];
+            for (int i = index.dependentOffsets[id]; i < index.dependentOffsets[id + 1]; i++) {
+                int dependent = index.dependents[i];
+                if (!visited[dependent]) {
+                    visited[dependent] = true;
+                    queue.push_back(dependent);
+                    reached.push_back(dependent);
+                }
+            }
+        }
+
+        sort(reached.begin(), reached.end());
+        cached = index.impactCache.insert(make_pair(start, reached)).first;
+    }
+
+    for (int id : cached->second) {
+        impacted.push_back(index.codes[id]);
+    }
+
+    return true;
+}
+
+/**
+ * Function: Pack Course Number
+ * Purpose: Copies a course number into a zero-padded fixed-width key
+ * Input: courseNumber - course number, key - reference to key to fill
+ * Output: false if the course number is longer than COMPACT_KEY_WIDTH
+ */
+bool packCourseNumber(const string& courseNumber, PackedKey& key) {
+    if (courseNumber.size() > COMPACT_KEY_WIDTH) {
+        return false;
+    }
+    memset(key.bytes, 0, COMPACT_KEY_WIDTH);
+    memcpy(key.bytes, courseNumber.data(), courseNumber.size());
+    return true;
+}
+
+/**
+ * Function: Build Compact Catalog
+ * Purpose: Copies every course into structure-of-arrays storage sorted by course number
+ * Input: table - hash table containing courses, catalog - reference to compact catalog to rebuild
+ * Output: true if built; false (and catalog left empty) if a course number does not fit a packed key
+ */
+bool buildCompactCatalog(const HashTable& table, CompactCatalog& catalog) {
+    catalog = CompactCatalog();
+
+    // Sort node pointers rather than copying courses
+    vector<const Course*> courses;
+    courses.reserve(table.size);
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            courses.push_back(&current->course);
+        }
+    }
+    sort(courses.begin(), courses.end(), [](const Course* a, const Course* b) {
+        return a->courseNumber < b->courseNumber;
+    });
+
+    size_t nameBytes = 0;
+    size_t prerequisiteCount = 0;
+    catalog.keys.resize(courses.size());
+    for (size_t id = 0; id < courses.size(); id++) {
+        if (!packCourseNumber(courses[id]->courseNumber, catalog.keys[id])) {
+            catalog = CompactCatalog();
+            return false;
+        }
+        nameBytes += courses[id]->name.size();
+        prerequisiteCount += courses[id]->prerequisites.size();
+    }
+
+    catalog.namePool.reserve(nameBytes);
+    catalog.nameOffsets.reserve(courses.size() + 1);
+    catalog.prerequisiteOffsets.reserve(courses.size() + 1);
+    catalog.prerequisites.reserve(prerequisiteCount);
+
+    PackedKey key;
+    for (const Course* course : courses) {
+        catalog.nameOffsets.push_back((unsigned int)catalog.namePool.size());
+        catalog.namePool += course->name;
+
+        // Prerequisites resolve to ids by binary search over the sorted keys
+        catalog.prerequisiteOffsets.push_back((unsigned int)catalog.prerequisites.size());
+        for (const string& prerequisite : course->prerequisites) {
+            if (!packCourseNumber(prerequisite, key)) {
+                continue;
+            }
+            auto found = lower_bound(catalog.keys.begin(), catalog.keys.end(), key,
+                [](const PackedKey& a, const PackedKey& b) { return memcmp(a.bytes, b.bytes, COMPACT_KEY_WIDTH) < 0; });
+            if (found != catalog.keys.end() && memcmp(found->bytes, key.bytes, COMPACT_KEY_WIDTH) == 0) {
+                catalog.prerequisites.push_back((unsigned int)(found - catalog.keys.begin()));
+            }
+        }
+    }
+    catalog.nameOffsets.push_back((unsigned int)catalog.namePool.size());
+    catalog.prerequisiteOffsets.push_back((unsigned int)catalog.prerequisites.size());
+    return true;
+}
+
+/**
+ * Function: Get Compact Course Number
+ * Purpose: Unpacks the course number of a compact catalog entry
+ * Input: catalog - compact catalog, id - course id
+ * Output: Course number
+ */
+string getCompactCourseNumber(const CompactCatalog& catalog, size_t id) {
+    const char* bytes = catalog.keys[id].bytes;
+    size_t length = 0;
+    while (length < COMPACT_KEY_WIDTH && bytes[length] != '\0') {
+        length++;
+    }
+    return string(bytes, length);
+}
+
+/**
+ * Function: Get Compact Catalog Bytes
+ * Purpose: Measures the memory held by a compact catalog
+ * Input: catalog - compact catalog
+ * Output: Bytes reserved by its arrays and string pool
+ */
+size_t getCompactCatalogBytes(const CompactCatalog& catalog) {
+    return sizeof(CompactCatalog)
+        + catalog.keys.capacity() * sizeof(PackedKey)
+        + catalog.nameOffsets.capacity() * sizeof(unsigned int)
+        + catalog.namePool.capacity() + 1
+        + catalog.prerequisiteOffsets.capacity() * sizeof(unsigned int)
+        + catalog.prerequisites.capacity() * sizeof(unsigned int);
+}
+
+/**
+ * Function: Get String Heap Bytes
+ * Purpose: Bytes a string keeps on the heap (0 when it fits the small-string buffer)
+ * Input: text - string to measure
+ * Output: Heap bytes, excluding allocator overhead
+ */
+size_t getStringHeapBytes(const string& text) {
+    static const size_t inlineCapacity = string().capacity();
+    return text.capacity() > inlineCapacity ? text.capacity() + 1 : 0;
+}
+
+/**
+ * Function: Get Course Heap Bytes
+ * Purpose: Measures the heap memory owned by a course's strings and prerequisite list
+ * Input: course - course to measure
+ * Output: Bytes, excluding the Course object itself and allocator overhead
+ */
+size_t getCourseHeapBytes(const Course& course) {
+    size_t bytes = getStringHeapBytes(course.courseNumber) + getStringHeapBytes(course.name);
+    bytes += course.prerequisites.capacity() * sizeof(string);
+    for (const string& prerequisite : course.prerequisites) {
+        bytes += getStringHeapBytes(prerequisite);
+    }
+    return bytes;
+}
+
+/**
+ * Function: Get Suggestion Index Size
+ * Purpose: Measures the memory used by the suggestion index
+ * Input: index - suggestion index to measure
+ * Output: Bytes (code table, directory and entries), excluding allocator overhead
+ */
+size_t getSuggestionIndexBytes(const SuggestionIndex& index) {
+    size_t bytes = sizeof(SuggestionIndex) + index.codes.capacity() * sizeof(string);
+    for (const string& code : index.codes) {
+        bytes += getStringHeapBytes(code);
+    }
+    bytes += index.directory.capacity() * sizeof(unsigned int);
+    bytes += index.entries.capacity() * sizeof(unsigned int);
+    return bytes;
+}
+
+/**
+ * Function: Format Byte Count
+ * Purpose: Formats a size for messages
+ * Input: bytes - size in bytes
+ * Output: Text such as "812 bytes", "14.2 KB" or "85.0 MB"
+ */
+string formatByteCount(unsigned long long bytes) {
+    char text[32];
+    if (bytes < 1024) {
+        snprintf(text, sizeof(text), "%llu bytes", bytes);
+    }
+    else if (bytes < 1024 * 1024) {
+        snprintf(text, sizeof(text), "%.1f KB", bytes / 1024.0);
+    }
+    else {
+        snprintf(text, sizeof(text), "%.1f MB", bytes / 1048576.0);
+    }
+    return text;
+}
+
+/**
+ * Function: Get Hash Table Bytes
+ * Purpose: Measures the memory held by the hash table's bucket array, nodes and course members
+ * Input: table - hash table to measure
+ * Output: Bytes, excluding allocator overhead
+ */
+size_t getHashTableBytes(const HashTable& table) {
+    size_t bytes = sizeof(HashTable) + table.buckets.capacity() * sizeof(HashNode*);
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            bytes += sizeof(HashNode) + getCourseHeapBytes(current->course);
+        }
+    }
+    return bytes;
+}
+
+/**
+ * Byte-level breakdown of a hash table's memory
+ */
+struct TableMemory {
+    size_t courses = 0;                 // Courses in the table
+    size_t tableBytes = 0;              // The HashTable struct itself
+    size_t bucketBytes = 0;             // Bucket pointer array (its capacity, not just used buckets)
+    size_t emptyBucketBytes = 0;        // Part of bucketBytes holding empty buckets
+    size_t nodeBytes = 0;               // HashNode objects (the Course members plus the chain pointer)
+    size_t nodeLinkBytes = 0;           // Part of nodeBytes that is not the Course: next pointer and padding
+    size_t strings = 0;                 // Course number, name and prerequisite strings
+    size_t inlineStrings = 0;           // Strings short enough for the small-string buffer (no allocation)
+    size_t inlineStringBytes = 0;       // Characters kept in those buffers (inside nodeBytes/prerequisiteBytes)
+    size_t heapStringBytes = 0;         // Heap buffers of the longer strings (capacity + terminator)
+    size_t heapStringUnusedBytes = 0;   // Part of heapStringBytes past each string's length
+    size_t prerequisiteBytes = 0;       // Prerequisite vector buffers (capacity x sizeof(string))
+    size_t prerequisiteSlackBytes = 0;  // Part of prerequisiteBytes past each vector's size
+    size_t allocations = 0;             // Heap blocks: bucket array, nodes, heap strings, prerequisite buffers
+    size_t allocatorBytes = 0;          // Estimated allocator headers and rounding on those blocks
+};
+
+/**
+ * Function: Get Allocator Overhead
+ * Purpose: Estimates what the allocator adds to one request (glibc-style chunks: 8-byte header,
+ *          16-byte granularity, 32-byte minimum); other allocators are in the same range
+ * Input: bytes - requested size
+ * Output: Extra bytes beyond the request
+ */
+size_t getAllocatorOverhead(size_t bytes) {
+    size_t chunk = max<size_t>(32, (bytes + 8 + 15) & ~(size_t)15);
+    return chunk - bytes;
+}
+
+/**
+ * Function: Measure String
+ * Purpose: Adds one string to a memory breakdown
+ * Input: text - string to measure, memory - reference to the breakdown
+ */
+void measureString(const string& text, TableMemory& memory) {
+    memory.strings++;
+    size_t heapBytes = getStringHeapBytes(text);
+    if (heapBytes == 0) {
+        memory.inlineStrings++;
+        memory.inlineStringBytes += text.size();
+        return;
+    }
+    memory.heapStringBytes += heapBytes;
+    memory.heapStringUnusedBytes += heapBytes - text.size();
+    memory.allocations++;
+    memory.allocatorBytes += getAllocatorOverhead(heapBytes);
+}
+
+/**
+ * Function: Measure Hash Table Memory
+ * Purpose: Breaks the table's memory down by where it goes
+ * Input: table - hash table to measure, memory - reference to the breakdown to fill
+ * Output: The parts (without allocatorBytes) add up to getHashTableBytes()
+ */
+void measureHashTableMemory(const HashTable& table, TableMemory& memory) {
+    memory = TableMemory();
+    memory.courses = table.size;
+    memory.tableBytes = sizeof(HashTable);
+    memory.bucketBytes = table.buckets.capacity() * sizeof(HashNode*);
+    if (memory.bucketBytes > 0) {
+        memory.allocations++;
+        memory.allocatorBytes += getAllocatorOverhead(memory.bucketBytes);
+    }
+
+    for (int i = 0; i < table.capacity; i++) {
+        if (table.buckets[i] == nullptr) {
+            memory.emptyBucketBytes += sizeof(HashNode*);
+        }
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            const Course& course = current->course;
+            memory.nodeBytes += sizeof(HashNode);
+            memory.nodeLinkBytes += sizeof(HashNode) - sizeof(Course);
+            memory.allocations++;
+            memory.allocatorBytes += getAllocatorOverhead(sizeof(HashNode));
+
+            measureString(course.courseNumber, memory);
+            measureString(course.name, memory);
+            if (course.prerequisites.capacity() > 0) {
+                size_t bytes = course.prerequisites.capacity() * sizeof(string);
+                memory.prerequisiteBytes += bytes;
+                memory.prerequisiteSlackBytes += (course.prerequisites.capacity() - course.prerequisites.size()) * sizeof(string);
+                memory.allocations++;
+                memory.allocatorBytes += getAllocatorOverhead(bytes);
+            }
+            for (const string& prerequisite : course.prerequisites) {
+                measureString(prerequisite, memory);
+            }
+        }
+    }
+}
+
+/**
+ * Function: Get Table Memory Total
+ * Purpose: Adds up a breakdown
+ * Input: memory - breakdown, withAllocator - include the estimated allocator overhead
+ * Output: Bytes
+ */
+size_t getTableMemoryTotal(const TableMemory& memory, bool withAllocator) {
+    return memory.tableBytes + memory.bucketBytes + memory.nodeBytes + memory.heapStringBytes
+        + memory.prerequisiteBytes + (withAllocator ? memory.allocatorBytes : 0);
+}
+
+/**
+ * Function: Display Memory Report
+ * Purpose: Prints where the table's memory goes, per course and as a share of the total, the size
+ *          of the lookup indexes built on top of it, plus the process RSS and the peak RSS of each
+ *          phase of the last load
+ * Input: table - hash table to measure, nameIndex - name search index, suggestionIndex - "did you mean" index
+ * Output: Breakdown table on the console
+ */
+void displayMemoryReport(const HashTable& table, const NameIndex& nameIndex, const SuggestionIndex& suggestionIndex) {
+    TableMemory memory;
+    measureHashTableMemory(table, memory);
+    size_t total = getTableMemoryTotal(memory, true);
+
+    ios::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    auto printRow = [&](const string& label, size_t bytes) {
+        cout << left << setw(38) << label << right << setw(12) << formatByteCount(bytes) << fixed << setprecision(1)
+            << setw(12) << (memory.courses > 0 ? (double)bytes / memory.courses : 0.0)
+            << setw(9) << (total > 0 ? bytes * 100.0 / total : 0.0) << "%" << endl;
+    };
+
+    cout << "\n=== Memory Report ===" << endl;
+    cout << "Courses: " << memory.courses << ", buckets: " << table.capacity << endl;
+    cout << left << setw(38) << "" << right << setw(12) << "bytes" << setw(12) << "per course" << setw(10) << "share" << endl;
+    printRow("HashTable struct", memory.tableBytes);
+    printRow("Bucket array", memory.bucketBytes);
+    printRow("  of which empty buckets", memory.emptyBucketBytes);
+    printRow("HashNode objects", memory.nodeBytes);
+    printRow("  of which chain pointer and padding", memory.nodeLinkBytes);
+    printRow("String heap buffers", memory.heapStringBytes);
+    printRow("  of which unused capacity", memory.heapStringUnusedBytes);
+    printRow("Prerequisite arrays", memory.prerequisiteBytes);
+    printRow("  of which unused capacity", memory.prerequisiteSlackBytes);
+    printRow("Allocator overhead (estimate)", memory.allocatorBytes);
+    printRow("Total", total);
+    cout << memory.inlineStrings << " of " << memory.strings << " strings fit the " << string().capacity()
+        << "-character small-string buffer (" << formatByteCount(memory.inlineStringBytes)
+        << " stored without an allocation); " << memory.allocations << " heap blocks" << endl;
+
+    // Indexes are separate allocations, so their share is relative to the table total above
+    cout << "Indexes (not in the table total):" << endl;
+    printRow("Name index", getNameIndexBytes(nameIndex));
+    printRow("Suggestion index", getSuggestionIndexBytes(suggestionIndex));
+
+    cout << "Process RSS: " << formatByteCount(getCurrentRssBytes()) << " now" << endl;
+#ifdef PROJECTTWO_DISABLE_INSTRUMENTATION
+    cout << "Load phase peaks need runtime instrumentation (disabled in this build)." << endl;
+#else
+    ThreadStats& stats = getThreadStats();
+    cout << "Last load peak RSS" << (stats.phasePeakRssReset.load(memory_order_relaxed) ? ":" : " (since start):");
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        // A streamed load has no separate read phase
+        unsigned long long peak = stats.phasePeakRss[phase].load(memory_order_relaxed);
+        if (peak > 0) {
+            cout << " " << PHASE_NAMES[phase] << "=" << formatByteCount(peak);
+        }
+    }
+    cout << endl;
+#endif
+    cout << "=========================================" << endl;
+    cout.flags(flags);
+    cout.precision(precision);
+}
+
+/**
+ * Function: Write Table Memory JSON
+ * Purpose: Writes a memory breakdown as one JSON object
+ * Input: out - output stream, memory - breakdown
+ */
+void writeTableMemoryJson(ostream& out, const TableMemory& memory) {
+    size_t total = getTableMemoryTotal(memory, true);
+    out << "{\"table_bytes\": " << memory.tableBytes
+        << ", \"bucket_bytes\": " << memory.bucketBytes
+        << ", \"empty_bucket_bytes\": " << memory.emptyBucketBytes
+        << ", \"node_bytes\": " << memory.nodeBytes
+        << ", \"node_link_bytes\": " << memory.nodeLinkBytes
+        << ", \"strings\": " << memory.strings
+        << ", \"inline_strings\": " << memory.inlineStrings
+        << ", \"inline_string_bytes\": " << memory.inlineStringBytes
+        << ", \"heap_string_bytes\": " << memory.heapStringBytes
+        << ", \"heap_string_unused_bytes\": " << memory.heapStringUnusedBytes
+        << ", \"prerequisite_bytes\": " << memory.prerequisiteBytes
+        << ", \"prerequisite_slack_bytes\": " << memory.prerequisiteSlackBytes
+        << ", \"allocations\": " << memory.allocations
+        << ", \"allocator_bytes\": " << memory.allocatorBytes
+        << ", \"total_bytes\": " << total
+        << ", \"bytes_per_course\": " << (memory.courses > 0 ? (double)total / memory.courses : 0.0) << "}";
+}
+
+/**
+ * Function: Write Memory Report
+ * Purpose: Dumps the memory breakdown, index sizes and RSS figures as JSON for tooling
+ * Input: table - hash table to measure, nameIndex - name search index,
+ *        suggestionIndex - "did you mean" index, path - output file
+ * Output: true if the file was written
+ */
+bool writeMemoryReportJson(const HashTable& table, const NameIndex& nameIndex, const SuggestionIndex& suggestionIndex,
+    const string& path) {
+    ofstream file(path);
+    if (!file.is_open()) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+
+    TableMemory memory;
+    measureHashTableMemory(table, memory);
+    file << "{\n  \"courses\": " << memory.courses << ",\n  \"buckets\": " << table.capacity
+        << ",\n  \"string_inline_capacity\": " << string().capacity()
+        << ",\n  \"table\": ";
+    writeTableMemoryJson(file, memory);
+    file << ",\n  \"indexes\": {\"name_index_bytes\": " << getNameIndexBytes(nameIndex)
+        << ", \"suggestion_index_bytes\": " << getSuggestionIndexBytes(suggestionIndex)
+        << ", \"suggestion_variants\": " << suggestionIndex.entries.size() << "},\n";
+    file << "  \"rss_bytes\": " << getCurrentRssBytes() << ",\n  \"last_load_peak_rss_bytes\": ";
+#ifdef PROJECTTWO_DISABLE_INSTRUMENTATION
+    file << "null,\n  \"peaks_per_phase\": false\n}\n";
+#else
+    ThreadStats& stats = getThreadStats();
+    file << "{";
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        file << (phase > 0 ? ", " : "") << "\"" << PHASE_NAMES[phase] << "\": "
+            << stats.phasePeakRss[phase].load(memory_order_relaxed);
+    }
+    file << "},\n  \"peaks_per_phase\": " << (stats.phasePeakRssReset.load(memory_order_relaxed) ? "true" : "false")
+        << "\n}\n";
+#endif
+    return true;
+}
+
+/**
+ * Function: Print All Courses Compact
+ * Purpose: Displays every course from the compact catalog, which is already in order
+ * Input: catalog - compact catalog
+ * Output: Displays all courses sorted by course number, 10 per page
+ */
+void printAllCoursesCompact(const CompactCatalog& catalog) {
+    printPaginated(catalog.keys.size(), [&catalog](size_t id) {
+        cout << getCompactCourseNumber(catalog, id) << ", ";
+        cout.write(catalog.namePool.data() + catalog.nameOffsets[id], catalog.nameOffsets[id + 1] - catalog.nameOffsets[id]);
+        cout << endl;
+    });
+}
+
+/**
+ * Function: Get Catalog History Bytes
+ * Purpose: Measures the memory held by the history's map, records and course members
+ * Input: history - catalog history to measure
+ * Output: Approximate bytes (map nodes counted as key/value plus two pointers), excluding allocator overhead
+ */
+size_t getCatalogHistoryBytes(const CatalogHistory& history) {
+    size_t bytes = sizeof(CatalogHistory) + history.terms.capacity() * sizeof(int);
+    bytes += history.versions.bucket_count() * sizeof(void*);
+    for (const auto& entry : history.versions) {
+        bytes += sizeof(entry) + 2 * sizeof(void*) + getStringHeapBytes(entry.first);
+        bytes += entry.second.capacity() * sizeof(CourseVersion);
+        for (const CourseVersion& version : entry.second) {
+            bytes += getCourseHeapBytes(version.course);
+        }
+    }
+    return bytes;
+}
+
+/**
+ * Function: Embedded Catalog Hash
+ * Purpose: Seeded FNV-1a with a final avalanche; the generator and the lookup must agree on it
+ * Input: seed - hash seed (0 picks the bucket, the bucket's seed picks the slot),
+ *        key - course number characters, length - number of characters
+ * Output: 32-bit hash
+ */
+constexpr unsigned int embeddedCatalogHash(unsigned int seed, const char* key, size_t length) {
+    unsigned int hash = 2166136261u ^ (seed * 0x9E3779B1u);
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)key[i];
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * Function: Find Embedded Course
+ * Purpose: Looks a course up in the built-in catalog through its perfect-hash index;
+ *          one probe, no parsing and no heap allocation
+ * Input: courseNumber - course to find
+ * Output: Pointer to the course record, or nullptr if absent (or no catalog is built in)
+ */
+const EmbeddedCourse* findEmbeddedCourse(const string& courseNumber) {
+    if (EMBEDDED_COURSE_COUNT == 0) {
+        return nullptr;
+    }
+
+    unsigned int bucket = embeddedCatalogHash(0, courseNumber.data(), courseNumber.size()) % EMBEDDED_BUCKET_COUNT;
+    unsigned int slot = embeddedCatalogHash(EMBEDDED_SEEDS[bucket], courseNumber.data(), courseNumber.size())
+        % EMBEDDED_SLOT_COUNT;
+    unsigned int id = EMBEDDED_SLOTS[slot];
+
+    if (id == EMBEDDED_EMPTY_SLOT || courseNumber.compare(EMBEDDED_COURSES[id].courseNumber) != 0) {
+        return nullptr;
+    }
+    return &EMBEDDED_COURSES[id];
+}
+
+/**
+ * Function: Print Embedded Course
+ * Purpose: Prints a built-in course and its prerequisites like menu option 3 does
+ * Input: course - course record from the built-in catalog
+ */
+void printEmbeddedCourse(const EmbeddedCourse& course) {
+    cout << course.courseNumber << ", " << course.name << endl;
+    cout << endl;
+
+    if (course.prerequisiteCount == 0) {
+        cout << "No prerequisites required" << endl;
+        return;
+    }
+
+    cout << "Prerequisites: ";
+    for (unsigned int i = 0; i < course.prerequisiteCount; i++) {
+        const EmbeddedCourse& prerequisite = EMBEDDED_COURSES[EMBEDDED_PREREQUISITES[course.firstPrerequisite + i]];
+        cout << prerequisite.courseNumber << ", " << prerequisite.name << (i + 1 < course.prerequisiteCount ? "; " : "");
+    }
+    cout << endl;
+}
+
+/**
+ * Function: Load Embedded Catalog
+ * Purpose: Copies the built-in catalog into the hash table so every menu option can use it
+ * Input: table - reference to hash table to populate
+ * Output: true if a catalog is built into this program
+ */
+bool loadEmbeddedCatalog(HashTable& table) {
+    if (EMBEDDED_COURSE_COUNT == 0) {
+        cout << "Error: This build has no built-in catalog" << endl;
+        return false;
+    }
+
+    for (unsigned int id = 0; id < EMBEDDED_COURSE_COUNT; id++) {
+        const EmbeddedCourse& embedded = EMBEDDED_COURSES[id];
+        Course course;
+        course.courseNumber = embedded.courseNumber;
+        course.name = embedded.name;
+        for (unsigned int i = 0; i < embedded.prerequisiteCount; i++) {
+            course.prerequisites.push_back(EMBEDDED_COURSES[EMBEDDED_PREREQUISITES[embedded.firstPrerequisite + i]].courseNumber);
+        }
+        insertCourseIntoTable(table, course);
+    }
+
+    cout << "Loaded " << EMBEDDED_COURSE_COUNT << " courses from the built-in catalog ("
+        << EMBEDDED_CATALOG_SOURCE << ")" << endl;
+    return true;
+}
+
+/**
+ * Function: Clean Up Hash Table
+ * Purpose: Deallocates all memory used by hash table
+ * Input: table - reference to hash table to clean up
+ * Output: Frees all nodes and resets table to empty state
+ */
+void cleanupHashTable(HashTable& table) {
+    // Traverse all buckets in the hash table
+    for (int i = 0; i < table.capacity; i++) {
+        HashNode* current = table.buckets[i];
+
+        // Delete all nodes in the collision chain at this bucket
+        while (current != nullptr) {
+            HashNode* next = current->next;
+            delete current;
+            current = next;
+        }
+
+        // Set bucket pointer to null
+        table.buckets[i] = nullptr;
+    }
+
+    // Reset table properties
+    table.size = 0;
+
+    if (table.verbose) {
+        cout << "Hash table memory cleaned up successfully" << endl;
+    }
+}
+
+/**
+ * One shard of a ShardedHashTable: an ordinary chained table behind a reader-writer lock
+ */
+struct HashTableShard {
+    HashTable table;                   // Courses whose number maps to this shard (resizes on its own)
+    mutable shared_timed_mutex lock;   // Shared for lookups, exclusive for insert/upsert/erase
+};
+
+/**
+ * Concurrent course table split into independently locked shards so ingestion
+ * threads and queries only contend when they touch the same shard
+ * Library for concurrent writers, exercised by Benchmark.cpp. It does not replace the application's
+ * HashTable: loadCatalogFiles, every index and every menu option use the single-writer table (and its
+ * global resizeHashTable)
+ */
+struct ShardedHashTable {
+    vector<unique_ptr<HashTableShard>> shards; // Separate allocations keep shard locks off shared cache lines
+};
+
+const int DEFAULT_SHARD_COUNT = 64; // Shards per ShardedHashTable unless specified
+
+/**
+ * Function: Initialize Sharded Hash Table
+ * Purpose: Creates the shards of a concurrent table
+ * Input: table - reference to table to (re)initialize, shardCount - number of shards,
+ *        initialCapacity - starting buckets per shard
+ * Output: Empty table; shard tables do not print resize messages
+ */
+void initializeShardedTable(ShardedHashTable& table, int shardCount = DEFAULT_SHARD_COUNT, int initialCapacity = 16) {
+    table.shards.clear();
+    for (int i = 0; i < shardCount; i++) {
+        unique_ptr<HashTableShard> shard(new HashTableShard());
+        shard->table = initializeHashTable(initialCapacity);
+        shard->table.verbose = false;
+        table.shards.push_back(move(shard));
+    }
+}
+
+/**
+ * Function: Shard Index
+ * Purpose: Chooses the shard for a course number
+ * Input: courseNumber - key, shardCount - number of shards
+ * Output: Shard index; uses FNV-1a rather than hashFunction so the bucket index
+ *         inside a shard stays independent of the shard choice
+ */
+int shardIndex(const string& courseNumber, size_t shardCount) {
+    unsigned int hash = 2166136261u;
+    for (char c : courseNumber) {
+        hash ^= (unsigned char)c;
+        hash *= 16777619u;
+    }
+    return (int)(hash % shardCount);
+}
+
+/**
+ * Function: Get Shard
+ * Purpose: Returns the shard that owns a course number
+ */
+HashTableShard& getShard(const ShardedHashTable& table, const string& courseNumber) {
+    return *table.shards[shardIndex(courseNumber, table.shards.size())];
+}
+
+/**
+ * Function: Sharded Search
+ * Purpose: Looks up a course under its shard's shared lock
+ * Input: table - sharded table, courseNumber - course to find, foundCourse - reference to Course to populate
+ * Output: true if found
+ */
+bool shardedSearch(const ShardedHashTable& table, const string& courseNumber, Course& foundCourse) {
+    HashTableShard& shard = getShard(table, courseNumber);
+    shared_lock<shared_timed_mutex> guard(shard.lock);
+    return searchCourse(shard.table, courseNumber, foundCourse);
+}
+
+/**
+ * Function: Sharded Insert
+ * Purpose: Adds a course only if its number is not present yet
+ * Input: table - sharded table, course - course to add
+ * Output: true if inserted, false if the course number already existed (table unchanged)
+ */
+bool shardedInsert(ShardedHashTable& table, const Course& course) {
+    HashTableShard& shard = getShard(table, course.courseNumber);
+    unique_lock<shared_timed_mutex> guard(shard.lock);
+
+    if (findCourseInTable(shard.table, course.courseNumber) != nullptr) {
+        return false;
+    }
+    insertCourseIntoTable(shard.table, course);
+    return true;
+}
+
+/**
+ * Function: Sharded Upsert
+ * Purpose: Adds a course or replaces the existing course with the same number
+ * Input: table - sharded table, course - course to store
+ * Output: true if the course was new, false if an existing course was replaced
+ */
+bool shardedUpsert(ShardedHashTable& table, const Course& course) {
+    HashTableShard& shard = getShard(table, course.courseNumber);
+    unique_lock<shared_timed_mutex> guard(shard.lock);
+
+    int sizeBefore = shard.table.size;
+    insertCourseIntoTable(shard.table, course); // resizes only this shard when needed
+    return shard.table.size > sizeBefore;
+}
+
+/**
+ * Function: Sharded Erase
+ * Purpose: Removes a course
+ * Input: table - sharded table, courseNumber - course to remove
+ * Output: true if a course was removed
+ */
+bool shardedErase(ShardedHashTable& table, const string& courseNumber) {
+    HashTableShard& shard = getShard(table, courseNumber);
+    unique_lock<shared_timed_mutex> guard(shard.lock);
+    return removeCourseFromTable(shard.table, courseNumber);
+}
+
+/**
+ * Function: Sharded Size
+ * Purpose: Counts courses across all shards
+ * Output: Total courses (a snapshot when writers are active)
+ */
+int shardedSize(const ShardedHashTable& table) {
+    int total = 0;
+    for (const unique_ptr<HashTableShard>& shard : table.shards) {
+        shared_lock<shared_timed_mutex> guard(shard->lock);
+        total += shard->table.size;
+    }
+    return total;
+}
+
+/**
+ * Function: Clean Up Sharded Hash Table
+ * Purpose: Frees every shard's nodes
+ * Input: table - reference to sharded table (no other thread may use it)
+ */
+void cleanupShardedTable(ShardedHashTable& table) {
+    for (unique_ptr<HashTableShard>& shard : table.shards) {
+        unique_lock<shared_timed_mutex> guard(shard->lock);
+        cleanupHashTable(shard->table);
+    }
+}
+
+/*
+ * Course edit log
+ * Record layout (little endian): [u32 payload length][u32 CRC-32 of payload] followed by the
+ * payload [u8 type][u64 sequence][varint length + course number][varint length + name]
+ * [varint prerequisite count][varint length + prerequisite]... A checkpoint is
+ * [magic "PTCK"][u32 version][u64 last sequence][u64 course count] followed by one
+ * EDIT_ADD record per course.
+ */
+
+/**
+ * Function: CRC-32
+ * Purpose: Computes the IEEE CRC-32 used to detect torn or corrupt log records and export columns
+ *          (slicing-by-8: eight table lookups per 8 input bytes instead of one per byte)
+ * Input: data - bytes to check, size - number of bytes
+ * Output: CRC-32 value
+ */
+unsigned int crc32Bytes(const unsigned char* data, size_t size) {
+    // table[k][b] = CRC of byte b followed by k zero bytes
+    static const vector<vector<unsigned int>> table = []() {
+        vector<vector<unsigned int>> entries(8, vector<unsigned int>(256));
+        for (unsigned int i = 0; i < 256; i++) {
+            unsigned int value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+            }
+            entries[0][i] = value;
+        }
+        for (unsigned int i = 0; i < 256; i++) {
+            for (int k = 1; k < 8; k++) {
+                entries[k][i] = entries[0][entries[k - 1][i] & 0xFF] ^ (entries[k - 1][i] >> 8);
+            }
+        }
+        return entries;
+    }();
+    const unsigned int* t0 = table[0].data();
+    const unsigned int* t1 = table[1].data();
+    const unsigned int* t2 = table[2].data();
+    const unsigned int* t3 = table[3].data();
+    const unsigned int* t4 = table[4].data();
+    const unsigned int* t5 = table[5].data();
+    const unsigned int* t6 = table[6].data();
+    const unsigned int* t7 = table[7].data();
+
+    unsigned int crc = 0xFFFFFFFFu;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        unsigned int low = crc ^ ((unsigned int)data[i] | (unsigned int)data[i + 1] << 8
+            | (unsigned int)data[i + 2] << 16 | (unsigned int)data[i + 3] << 24);
+        crc = t7[low & 0xFF] ^ t6[(low >> 8) & 0xFF] ^ t5[(low >> 16) & 0xFF] ^ t4[low >> 24]
+            ^ t3[data[i + 4]] ^ t2[data[i + 5]] ^ t1[data[i + 6]] ^ t0[data[i + 7]];
+    }
+    for (; i < size; i++) {
+        crc = t0[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/**
+ * Function: Append Little Endian
+ * Purpose: Writes the low bytes of a value, least significant first
+ * Input: bytes - byte stream, value - value to append, width - number of bytes
+ */
+void appendLittleEndian(vector<unsigned char>& bytes, unsigned long long value, int width) {
+    for (int i = 0; i < width; i++) {
+        bytes.push_back((unsigned char)(value >> (8 * i)));
+    }
+}
+
+/**
+ * Function: Read Little Endian
+ * Purpose: Reads a value written by appendLittleEndian
+ * Input: data - bytes to read from, width - number of bytes
+ * Output: Decoded value
+ */
+unsigned long long readLittleEndian(const unsigned char* data, int width) {
+    unsigned long long value = 0;
+    for (int i = 0; i < width; i++) {
+        value |= (unsigned long long)data[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * Function: Append Course Record
+ * Purpose: Encodes one edit as a length- and CRC-prefixed record
+ * Input: bytes - byte stream to extend, type - CourseEditType, sequence - edit number, course - course data
+ */
+void appendCourseRecord(vector<unsigned char>& bytes, unsigned char type, unsigned long long sequence,
+    const Course& course) {
+    size_t header = bytes.size();
+    appendLittleEndian(bytes, 0, 8); // Length and CRC, filled in below
+
+    size_t start = bytes.size();
+    bytes.push_back(type);
+    appendLittleEndian(bytes, sequence, 8);
+    appendVarint(bytes, (unsigned int)course.courseNumber.size());
+    bytes.insert(bytes.end(), course.courseNumber.begin(), course.courseNumber.end());
+    if (type != EDIT_REMOVE) {
+        appendVarint(bytes, (unsigned int)course.name.size());
+        bytes.insert(bytes.end(), course.name.begin(), course.name.end());
+        appendVarint(bytes, (unsigned int)course.prerequisites.size());
+        for (const string& prerequisite : course.prerequisites) {
+            appendVarint(bytes, (unsigned int)prerequisite.size());
+            bytes.insert(bytes.end(), prerequisite.begin(), prerequisite.end());
+        }
+    }
+
+    unsigned int length = (unsigned int)(bytes.size() - start);
+    unsigned int crc = crc32Bytes(&bytes[start], length);
+    for (int i = 0; i < 4; i++) {
+        bytes[header + i] = (unsigned char)(length >> (8 * i));
+        bytes[header + 4 + i] = (unsigned char)(crc >> (8 * i));
+    }
+}
+
+/**
+ * Function: Read Length-Prefixed String
+ * Purpose: Decodes a varint length and that many bytes, staying inside a record
+ * Input: bytes - byte stream, offset - reference to read position, end - end of the record,
+ *        text - reference to string to fill
+ * Output: false if the string runs past the end of the record
+ */
+bool readLengthPrefixed(const vector<unsigned char>& bytes, size_t& offset, size_t end, string& text) {
+    size_t length = readVarint(bytes, offset);
+    if (offset > end || length > end - offset) {
+        return false;
+    }
+    text.assign((const char*)&bytes[offset], length);
+    offset += length;
+    return true;
+}
+
+/**
+ * Function: Decode Course Record
+ * Purpose: Decodes the record at offset if it is complete and its CRC matches
+ * Input: bytes - file contents, offset - reference to record start (advanced on success),
+ *        edit - reference to edit to fill
+ * Output: false at the end of the data or at a torn or corrupt record
+ */
+bool decodeCourseRecord(const vector<unsigned char>& bytes, size_t& offset, CourseEdit& edit) {
+    if (bytes.size() - offset < 8) {
+        return false;
+    }
+    size_t length = (size_t)readLittleEndian(&bytes[offset], 4);
+    unsigned int crc = (unsigned int)readLittleEndian(&bytes[offset + 4], 4);
+    size_t start = offset + 8;
+    if (length < 9 || bytes.size() - start < length || crc32Bytes(&bytes[start], length) != crc) {
+        return false;
+    }
+
+    size_t end = start + length;
+    size_t position = start;
+    edit = CourseEdit();
+    edit.type = bytes[position++];
+    edit.sequence = readLittleEndian(&bytes[position], 8);
+    position += 8;
+    if (!readLengthPrefixed(bytes, position, end, edit.course.courseNumber)) {
+        return false;
+    }
+    if (edit.type != EDIT_REMOVE) {
+        if (!readLengthPrefixed(bytes, position, end, edit.course.name)) {
+            return false;
+        }
+        size_t count = readVarint(bytes, position);
+        for (size_t i = 0; i < count; i++) {
+            string prerequisite;
+            if (position > end || !readLengthPrefixed(bytes, position, end, prerequisite)) {
+                return false;
+            }
+            edit.course.prerequisites.push_back(prerequisite);
+        }
+    }
+
+    offset = end;
+    return edit.type >= EDIT_ADD && edit.type <= EDIT_REMOVE;
+}
+
+/**
+ * Function: Read Binary File
+ * Purpose: Reads a whole file into memory
+ * Input: path - file to read, bytes - reference to vector receiving the contents
+ * Output: false if the file cannot be opened
+ */
+bool readBinaryFile(const string& path, vector<unsigned char>& bytes) {
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    streamoff size = file.tellg();
+    bytes.resize((size_t)max<streamoff>(0, size));
+    file.seekg(0);
+    if (!bytes.empty()) {
+        file.read((char*)bytes.data(), bytes.size());
+    }
+    return true;
+}
+
+/**
+ * Function: Write And Sync
+ * Purpose: Writes every byte to a file descriptor, then forces it to stable storage
+ * Input: fd - open file, data - bytes to write, size - number of bytes
+ * Output: true if the write and the fsync succeeded
+ */
+bool writeAndSync(int fd, const unsigned char* data, size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int written = _write(fd, data, (unsigned int)min<size_t>(size, 1 << 30));
+#else
+        ssize_t written = write(fd, data, size);
+#endif
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+#ifdef _WIN32
+    return _commit(fd) == 0;
+#else
+    return fsync(fd) == 0;
+#endif
+}
+
+/**
+ * Function: Open Log File
+ * Purpose: Opens a file for appending binary records, creating it if needed
+ * Input: path - file to open, truncate - discard existing contents
+ * Output: File descriptor, or -1 on error
+ */
+int openLogFile(const string& path, bool truncate) {
+#ifdef _WIN32
+    return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY | (truncate ? _O_TRUNC : 0),
+        _S_IREAD | _S_IWRITE);
+#else
+    return open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | (truncate ? O_TRUNC : 0), 0644);
+#endif
+}
+
+/**
+ * Function: Close Log File
+ * Purpose: Closes a descriptor opened by openLogFile
+ * Input: fd - file descriptor
+ */
+void closeLogFile(int fd) {
+#ifdef _WIN32
+    _close(fd);
+#else
+    close(fd);
+#endif
+}
+
+/**
+ * Function: Truncate Log File
+ * Purpose: Cuts a file opened by openLogFile to a given size
+ * Input: fd - file descriptor, bytes - size to keep
+ * Output: true on success
+ */
+bool truncateLogFile(int fd, unsigned long long bytes) {
+#ifdef _WIN32
+    return _chsize_s(fd, (long long)bytes) == 0;
+#else
+    return ftruncate(fd, (off_t)bytes) == 0;
+#endif
+}
+
+/**
+ * Function: Replace File Durably
+ * Purpose: Writes a whole file beside the old one, then swaps it in with one rename, so a
+ *          crash leaves either the complete old file or the complete new one
+ * Input: path - file to replace, bytes - new contents
+ * Output: true once the new contents and the rename are on stable storage
+ */
+bool replaceFileDurably(const string& path, const vector<unsigned char>& bytes) {
+    string temporaryPath = path + ".tmp";
+    int fd = openLogFile(temporaryPath, true);
+    bool written = fd >= 0 && writeAndSync(fd, bytes.data(), bytes.size());
+    if (fd >= 0) {
+        closeLogFile(fd);
+    }
+#ifdef _WIN32
+    bool replaced = written && MoveFileExA(temporaryPath.c_str(), path.c_str(),
+        MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool replaced = written && rename(temporaryPath.c_str(), path.c_str()) == 0;
+    if (replaced) {
+        // The rename is only durable once the directory entry is synced
+        size_t slash = path.find_last_of('/');
+        string directory = slash == string::npos ? "." : path.substr(0, max<size_t>(slash, 1));
+        int directoryFd = open(directory.c_str(), O_RDONLY);
+        if (directoryFd >= 0) {
+            fsync(directoryFd);
+            close(directoryFd);
+        }
+    }
+#endif
+    return replaced;
+}
+
+/**
+ * Function: Apply Course Edit
+ * Purpose: Applies one edit to the table (used by the edit API and by recovery)
+ * Input: table - reference to hash table, edit - edit to apply
+ */
+void applyCourseEdit(HashTable& table, const CourseEdit& edit) {
+    if (edit.type == EDIT_REMOVE) {
+        removeCourseFromTable(table, edit.course.courseNumber);
+    }
+    else {
+        insertCourseIntoTable(table, edit.course);
+    }
+}
+
+/**
+ * Function: Commit Course Log
+ * Purpose: Writes every buffered edit with a single fsync (group commit). If the write fails, the
+ *          buffered edits are undone in the table (newest first) and any part of them that reached
+ *          the file is cut off again
+ * Input: log - reference to open course log, table - reference to the hash table the edits were applied to
+ * Output: true if all buffered edits are durable; false if they were undone
+ */
+bool commitCourseLog(CourseLog& log, HashTable& table) {
+    if (log.pendingRecords == 0) {
+        return true;
+    }
+    if (log.fd < 0 || !writeAndSync(log.fd, log.pending.data(), log.pending.size())) {
+        cout << "Error: Cannot write course edit log '" << log.logPath << "'; the last " << log.pendingRecords
+            << (log.pendingRecords == 1 ? " edit was" : " edits were") << " undone" << endl;
+        for (size_t i = log.undo.size(); i-- > 0;) {
+            applyCourseEdit(table, log.undo[i]);
+        }
+        log.nextSequence -= log.pendingRecords;
+        log.pending.clear();
+        log.pendingRecords = 0;
+        log.undo.clear();
+
+        // Records left in the file would come back at the next start, so stop logging if they stay
+        if (log.fd >= 0 && !truncateLogFile(log.fd, log.logBytes)) {
+            cout << "Error: Cannot restore '" << log.logPath << "'; editing is turned off" << endl;
+            closeLogFile(log.fd);
+            log.fd = -1;
+        }
+        return false;
+    }
+
+    log.syncCount++;
+    log.logBytes += log.pending.size();
+    log.pending.clear();
+    log.pendingRecords = 0;
+    log.undo.clear();
+    return true;
+}
+
+/**
+ * Function: Checkpoint Course Log
+ * Purpose: Compacts the log: writes the whole table to a new checkpoint, swaps it in atomically
+ *          and empties the log. A crash at any point leaves either the old checkpoint plus the
+ *          full log or the new checkpoint (whose sequence number makes replay skip old records)
+ * Input: log - reference to open course log, table - current courses
+ * Output: true if the new checkpoint is durable and the log was truncated
+ */
+bool checkpointCourseLog(CourseLog& log, HashTable& table) {
+    if (!commitCourseLog(log, table)) {
+        return false;
+    }
+
+    vector<unsigned char> bytes;
+    bytes.insert(bytes.end(), COURSE_CHECKPOINT_MAGIC, COURSE_CHECKPOINT_MAGIC + 4);
+    appendLittleEndian(bytes, COURSE_CHECKPOINT_VERSION, 4);
+    appendLittleEndian(bytes, log.nextSequence - 1, 8);
+    appendLittleEndian(bytes, (unsigned long long)table.size, 8);
+    for (int i = 0; i < table.capacity; i++) {
+        for (HashNode* current = table.buckets[i]; current != nullptr; current = current->next) {
+            appendCourseRecord(bytes, EDIT_ADD, 0, current->course);
+        }
+    }
+
+    if (!replaceFileDurably(log.checkpointPath, bytes)) {
+        cout << "Error: Cannot write checkpoint '" << log.checkpointPath << "'" << endl;
+        return false;
+    }
+    log.syncCount++;
+    log.checkpointBytes = bytes.size();
+
+    // Every logged edit is now in the checkpoint
+    closeLogFile(log.fd);
+    log.fd = openLogFile(log.logPath, true);
+    log.logBytes = 0;
+    if (log.fd < 0) {
+        cout << "Error: Cannot reopen course edit log '" << log.logPath << "'" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Open Course Log
+ * Purpose: Enables durable edits; the current table becomes the first checkpoint. An existing log
+ *          is only emptied once that checkpoint is durable, and numbering continues past its
+ *          records, so a crash in between still replays correctly
+ * Input: log - reference to course log, table - current courses, logPath, checkpointPath - files to use
+ * Output: true if the log and checkpoint were created
+ */
+bool openCourseLog(CourseLog& log, HashTable& table, const string& logPath = COURSE_LOG_PATH,
+    const string& checkpointPath = COURSE_CHECKPOINT_PATH) {
+    log.logPath = logPath;
+    log.checkpointPath = checkpointPath;
+
+    vector<unsigned char> bytes;
+    if (readBinaryFile(logPath, bytes)) {
+        size_t offset = 0;
+        CourseEdit edit;
+        while (decodeCourseRecord(bytes, offset, edit)) {
+            log.nextSequence = max(log.nextSequence, edit.sequence + 1);
+        }
+    }
+    log.fd = openLogFile(logPath, false);
+    if (log.fd < 0) {
+        cout << "Error: Cannot create course edit log '" << logPath << "'" << endl;
+        return false;
+    }
+    return checkpointCourseLog(log, table);
+}
+
+/**
+ * Function: Close Course Log
+ * Purpose: Commits buffered edits and closes the log
+ * Input: log - reference to course log, table - reference to the hash table the edits were applied to
+ */
+void closeCourseLog(CourseLog& log, HashTable& table) {
+    if (log.fd < 0) {
+        return;
+    }
+    commitCourseLog(log, table);
+    if (log.fd < 0) {
+        return;
+    }
+    closeLogFile(log.fd);
+    log.fd = -1;
+}
+
+/**
+ * Function: Log Course Edit
+ * Purpose: Applies an edit, buffers its log record, commits when the group is full and
+ *          compacts once the log is larger than half the checkpoint
+ * Input: log - reference to open course log, table - reference to hash table, edit - edit to record
+ * Output: true if the edit was applied (and, if its group committed, made durable); false if it
+ *         was not applied or its group's commit failed and the group was undone
+ */
+bool logCourseEdit(CourseLog& log, HashTable& table, CourseEdit& edit) {
+    if (log.fd < 0) {
+        cout << "Error: Course edit log is not open" << endl;
+        return false;
+    }
+
+    // Remember how to undo the edit until its group is durable
+    CourseEdit inverse;
+    const Course* previous = findCourseInTable(table, edit.course.courseNumber);
+    if (previous == nullptr) {
+        inverse.type = EDIT_REMOVE;
+        inverse.course.courseNumber = edit.course.courseNumber;
+    }
+    else {
+        inverse.type = EDIT_UPDATE;
+        inverse.course = *previous;
+    }
+    log.undo.push_back(move(inverse));
+
+    edit.sequence = log.nextSequence++;
+    appendCourseRecord(log.pending, edit.type, edit.sequence, edit.course);
+    log.pendingRecords++;
+    applyCourseEdit(table, edit);
+
+    if (log.pendingRecords >= log.groupCommitSize && !commitCourseLog(log, table)) {
+        return false;
+    }
+    if (log.logBytes >= max(log.compactMinBytes, log.checkpointBytes / 2) && !checkpointCourseLog(log, table)) {
+        // The edit is already durable in the log; compaction is retried after the next edit
+        cout << "Warning: Edit log compaction failed; the log keeps growing until it succeeds" << endl;
+    }
+    return true;
+}
+
+/**
+ * Function: Check Edit Prerequisites
+ * Purpose: Rejects prerequisites that do not exist or name the course itself
+ * Input: table - hash table, course - edited course
+ * Output: true if every prerequisite is an existing, different course
+ */
+bool checkEditPrerequisites(const HashTable& table, const Course& course) {
+    Course found;
+    for (const string& prerequisite : course.prerequisites) {
+        if (prerequisite == course.courseNumber || !searchCourse(table, prerequisite, found)) {
+            cout << "Error: Prerequisite '" << prerequisite << "' does not exist as a course" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Function: Add Course
+ * Purpose: Adds a new course durably
+ * Input: log - reference to open course log, table - reference to hash table, course - new course
+ * Output: true if added; false if it already exists or a prerequisite is missing
+ */
+bool addCourse(CourseLog& log, HashTable& table, const Course& course) {
+    Course existing;
+    if (searchCourse(table, course.courseNumber, existing)) {
+        cout << "Error: Course '" << course.courseNumber << "' already exists" << endl;
+        return false;
+    }
+    if (!checkEditPrerequisites(table, course)) {
+        return false;
+    }
+
+    CourseEdit edit;
+    edit.type = EDIT_ADD;
+    edit.course = course;
+    return logCourseEdit(log, table, edit);
+}
+
+/**
+ * Function: Update Course
+ * Purpose: Replaces an existing course's name and prerequisites durably
+ * Input: log - reference to open course log, table - reference to hash table, course - new course data
+ * Output: true if updated; false if the course does not exist or a prerequisite is missing
+ */
+bool updateCourse(CourseLog& log, HashTable& table, const Course& course) {
+    Course existing;
+    if (!searchCourse(table, course.courseNumber, existing)) {
+        cout << "Error: Course '" << course.courseNumber << "' not found" << endl;
+        return false;
+    }
+    if (!checkEditPrerequisites(table, course)) {
+        return false;
+    }
+
+    CourseEdit edit;
+    edit.type = EDIT_UPDATE;
+    edit.course = course;
+    return logCourseEdit(log, table, edit);
+}
+
+/**
+ * Function: Remove Course
+ * Purpose: Removes a course durably (callers check that no course still requires it)
+ * Input: log - reference to open course log, table - reference to hash table, courseNumber - course to remove
+ * Output: true if removed; false if the course does not exist
+ */
+bool removeCourse(CourseLog& log, HashTable& table, const string& courseNumber) {
+    Course existing;
+    if (!searchCourse(table, courseNumber, existing)) {
+        cout << "Error: Course '" << courseNumber << "' not found" << endl;
+        return false;
+    }
+
+    CourseEdit edit;
+    edit.type = EDIT_REMOVE;
+    edit.course.courseNumber = courseNumber;
+    return logCourseEdit(log, table, edit);
+}
+
+/**
+ * Results of replaying a checkpoint and log
+ */
+struct CourseRecoveryStats {
+    size_t checkpointCourses = 0;  // Courses read from the checkpoint
+    size_t logEdits = 0;           // Log records replayed
+    size_t skippedEdits = 0;       // Log records already contained in the checkpoint
+    size_t discardedBytes = 0;     // Torn or corrupt bytes cut from the end of the log
+    double seconds = 0.0;          // Time to rebuild the table
+};
+
+/**
+ * Function: Recover Course Log
+ * Purpose: Rebuilds the table from the checkpoint plus every complete log record after it,
+ *          cuts any torn tail off the log and reopens it for appending
+ * Input: log - reference to course log, table - reference to (empty) hash table,
+ *        stats - reference to stats to fill, logPath, checkpointPath - files to use
+ * Output: true if the checkpoint was valid (or absent) and the log could be reopened
+ */
+bool recoverCourseLog(CourseLog& log, HashTable& table, CourseRecoveryStats& stats,
+    const string& logPath = COURSE_LOG_PATH, const string& checkpointPath = COURSE_CHECKPOINT_PATH) {
+    auto start = chrono::steady_clock::now();
+    stats = CourseRecoveryStats();
+    log.logPath = logPath;
+    log.checkpointPath = checkpointPath;
+
+    // Step 1: Checkpoint
+    unsigned long long checkpointSequence = 0;
+    vector<unsigned char> bytes;
+    if (readBinaryFile(checkpointPath, bytes)) {
+        if (bytes.size() < 24 || memcmp(bytes.data(), COURSE_CHECKPOINT_MAGIC, 4) != 0
+            || readLittleEndian(&bytes[4], 4) != COURSE_CHECKPOINT_VERSION) {
+            cout << "Error: '" << checkpointPath << "' is not a course checkpoint" << endl;
+            return false;
+        }
+        checkpointSequence = readLittleEndian(&bytes[8], 8);
+        unsigned long long courses = readLittleEndian(&bytes[16], 8);
+
+        // The header has no CRC, so its count must fit the file before it sizes anything
+        if (courses > (bytes.size() - 24) / COURSE_RECORD_MIN_BYTES) {
+            cout << "Error: Checkpoint '" << checkpointPath << "' is damaged" << endl;
+            return false;
+        }
+
+        // Size the table once instead of resizing during replay
+        while ((double)courses / table.capacity > table.maxLoadFactor && table.capacity <= INT_MAX / 2) {
+            resizeHashTable(table);
+        }
+
+        size_t offset = 24;
+        CourseEdit edit;
+        while (decodeCourseRecord(bytes, offset, edit)) {
+            applyCourseEdit(table, edit);
+            stats.checkpointCourses++;
+        }
+        if (stats.checkpointCourses != courses || offset != bytes.size()) {
+            cout << "Error: Checkpoint '" << checkpointPath << "' is damaged" << endl;
+            return false;
+        }
+        log.checkpointBytes = bytes.size();
+    }
+
+    // Step 2: Log records after the checkpoint, up to the first torn or corrupt record
+    log.nextSequence = checkpointSequence + 1;
+    size_t validBytes = 0;
+    if (readBinaryFile(logPath, bytes)) {
+        CourseEdit edit;
+        while (decodeCourseRecord(bytes, validBytes, edit)) {
+            if (edit.sequence <= checkpointSequence) {
+                stats.skippedEdits++;
+                continue;
+            }
+            applyCourseEdit(table, edit);
+            log.nextSequence = edit.sequence + 1;
+            stats.logEdits++;
+        }
+        stats.discardedBytes = bytes.size() - validBytes;
+    }
+    vector<unsigned char>().swap(bytes);
+
+    // Step 3: Reopen for appending; a torn tail is cut so new records follow the last good one
+    log.fd = openLogFile(logPath, false);
+    if (log.fd >= 0 && stats.discardedBytes > 0) {
+        if (!truncateLogFile(log.fd, validBytes)) {
+            closeLogFile(log.fd);
+            log.fd = -1;
+        }
+    }
+    if (log.fd < 0) {
+        cout << "Error: Cannot open course edit log '" << logPath << "'" << endl;
+        return false;
+    }
+    log.logBytes = validBytes;
+
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+/**
+ * Function: Set Aside Damaged File
+ * Purpose: Renames an unreadable file to <path>.damaged so nothing written later replaces it
+ * Input: path - file to move (nothing happens if it does not exist)
+ * Output: false if the file exists and could not be renamed
+ */
+bool setAsideDamagedFile(const string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        return true;
+    }
+
+    // Never replace a copy kept from an earlier failure
+    string damagedPath = path + ".damaged";
+    for (int copy = 1; stat(damagedPath.c_str(), &info) == 0; copy++) {
+        damagedPath = path + ".damaged." + to_string(copy);
+    }
+    if (rename(path.c_str(), damagedPath.c_str()) != 0) {
+        cout << "Error: Cannot rename unreadable '" << path << "'; it was left in place" << endl;
+        return false;
+    }
+    cout << "Warning: Kept unreadable '" << path << "' as '" << damagedPath << "'" << endl;
+    return true;
+}
+
+/**
+ * Function: Set Aside Damaged Course Log
+ * Purpose: Renames an unrecoverable checkpoint and edit log out of the way so no later
+ *          edit can overwrite them, and turns editing off until the user starts a new log
+ * Input: log - reference to course log whose files could not be recovered
+ * Output: true if neither file is left at its original path
+ */
+bool setAsideCourseLog(CourseLog& log) {
+    if (log.fd >= 0) {
+        closeLogFile(log.fd);
+        log.fd = -1;
+    }
+    log.editingDisabled = true;
+
+    bool movedCheckpoint = setAsideDamagedFile(log.checkpointPath);
+    bool movedLog = setAsideDamagedFile(log.logPath);
+    cout << "Warning: Saved course edits could not be recovered. Editing (option 8) is off until you start a new edit log" << endl;
+    return movedCheckpoint && movedLog;
+}
+
+/**
+ * Function: Save Catalog History
+ * Purpose: Writes every recorded term and course record to disk, replacing the previous file atomically
+ * Input: history - catalog history, path - history file
+ * Output: true if the file is durable
+ * File layout: magic, version, term count, record count, terms (u32 each), then one CRC-checked
+ *              course record per version with [fromTerm, toTerm) packed into its sequence field
+ */
+bool saveCatalogHistory(const CatalogHistory& history, const string& path = CATALOG_HISTORY_PATH) {
+    vector<unsigned char> bytes;
+    bytes.insert(bytes.end(), CATALOG_HISTORY_MAGIC, CATALOG_HISTORY_MAGIC + 4);
+    appendLittleEndian(bytes, CATALOG_HISTORY_VERSION, 4);
+    appendLittleEndian(bytes, history.terms.size(), 8);
+    appendLittleEndian(bytes, history.records, 8);
+    for (int term : history.terms) {
+        appendLittleEndian(bytes, (unsigned int)term, 4);
+    }
+    for (const auto& entry : history.versions) {
+        for (const CourseVersion& version : entry.second) {
+            unsigned long long range = (unsigned long long)(unsigned int)version.fromTerm << 32
+                | (unsigned int)version.toTerm;
+            appendCourseRecord(bytes, EDIT_ADD, range, version.course);
+        }
+    }
+
+    if (!replaceFileDurably(path, bytes)) {
+        cout << "Error: Cannot write catalog history '" << path << "'" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Load Catalog History
+ * Purpose: Reads a file written by saveCatalogHistory
+ * Input: history - reference to (empty) catalog history, path - history file
+ * Output: true if the whole file was valid; history is left empty otherwise
+ */
+bool loadCatalogHistory(CatalogHistory& history, const string& path = CATALOG_HISTORY_PATH) {
+    vector<unsigned char> bytes;
+    if (!readBinaryFile(path, bytes)) {
+        cout << "Error: Cannot open catalog history '" << path << "'" << endl;
+        return false;
+    }
+    if (bytes.size() < 24 || memcmp(bytes.data(), CATALOG_HISTORY_MAGIC, 4) != 0
+        || readLittleEndian(&bytes[4], 4) != CATALOG_HISTORY_VERSION) {
+        cout << "Error: '" << path << "' is not a catalog history file" << endl;
+        return false;
+    }
+    unsigned long long termCount = readLittleEndian(&bytes[8], 8);
+    unsigned long long recordCount = readLittleEndian(&bytes[16], 8);
+
+    bool valid = termCount > 0 && termCount <= (bytes.size() - 24) / 4;
+    size_t offset = 24;
+    for (unsigned long long i = 0; valid && i < termCount; i++, offset += 4) {
+        int term = (int)readLittleEndian(&bytes[offset], 4);
+        valid = term > 0 && (history.terms.empty() || term > history.terms.back());
+        history.terms.push_back(term);
+    }
+
+    // Each course's records were written oldest first; every one but the last must be closed
+    CourseEdit edit;
+    while (valid && offset < bytes.size()) {
+        if (!decodeCourseRecord(bytes, offset, edit) || edit.type != EDIT_ADD) {
+            valid = false;
+            break;
+        }
+        CourseVersion version;
+        version.course = edit.course;
+        version.fromTerm = (int)(edit.sequence >> 32);
+        version.toTerm = (int)(unsigned int)edit.sequence;
+        vector<CourseVersion>& versions = history.versions[version.course.courseNumber];
+        valid = version.fromTerm < version.toTerm
+            && binary_search(history.terms.begin(), history.terms.end(), version.fromTerm)
+            && (versions.empty() || (versions.back().toTerm != TERM_OPEN && versions.back().toTerm <= version.fromTerm));
+        versions.push_back(version);
+        history.records++;
+    }
+
+    if (!valid || history.records != recordCount) {
+        cout << "Error: Catalog history '" << path << "' is damaged" << endl;
+        history = CatalogHistory();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Host Is Little Endian
+ * Purpose: Tells whether in-memory integers already have the file byte order
+ * Output: true on little-endian hosts
+ */
+bool hostIsLittleEndian() {
+    const unsigned int probe = 1;
+    return *(const unsigned char*)&probe == 1;
+}
+
+/**
+ * Function: Append Uint32 Column
+ * Purpose: Appends 32-bit values as little-endian bytes
+ * Input: bytes - reference to output buffer, values - values to append
+ */
+void appendUint32Column(vector<unsigned char>& bytes, const vector<unsigned int>& values) {
+    size_t start = bytes.size();
+    bytes.resize(start + values.size() * 4);
+    unsigned char* out = bytes.data() + start;
+    for (unsigned int value : values) {
+        out[0] = (unsigned char)value;
+        out[1] = (unsigned char)(value >> 8);
+        out[2] = (unsigned char)(value >> 16);
+        out[3] = (unsigned char)(value >> 24);
+        out += 4;
+    }
+}
+
+/**
+ * Function: Read Uint32 Column
+ * Purpose: Decodes little-endian 32-bit values
+ * Input: data - encoded bytes, size - number of bytes, values - reference to vector receiving size / 4 values
+ * Output: false if size is not a multiple of 4
+ */
+bool readUint32Column(const unsigned char* data, size_t size, vector<unsigned int>& values) {
+    if (size % 4 != 0) {
+        return false;
+    }
+    values.resize(size / 4);
+    if (hostIsLittleEndian()) {
+        // Little-endian host: the column is already in memory order
+        if (size > 0) {
+            memcpy(values.data(), data, size);
+        }
+        return true;
+    }
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = (unsigned int)readLittleEndian(data + i * 4, 4);
+    }
+    return true;
+}
+
+/**
+ * Function: Export Columnar Catalog
+ * Purpose: Writes a compact catalog as a columnar file: a directory of column offsets followed by
+ *          a department prefix dictionary, per-course prefix ids, front-coded key suffixes
+ *          (keys are sorted, so each suffix only stores what differs from the previous one),
+ *          and offset-indexed name and prerequisite edge columns
+ * Input: catalog - compact catalog (sorted, course ids are row numbers), path - output file,
+ *        fileBytes - reference receiving the file size
+ * Output: true if the whole file was written
+ */
+bool exportColumnarCatalog(const CompactCatalog& catalog, const string& path, size_t& fileBytes) {
+    size_t courseCount = catalog.keys.size();
+    vector<vector<unsigned char>> columns(COLUMN_COUNT);
+
+    // Keys: department dictionary (sorted keys give ids in first-seen order) plus front-coded suffixes;
+    // sorted keys keep each department together, so the dictionary is only consulted when it changes
+    vector<string> departments;
+    unordered_map<string, unsigned int> departmentIds;
+    vector<unsigned int> keyDepartments(courseCount);
+    vector<unsigned char>& suffixes = columns[COLUMN_KEY_SUFFIXES - 1];
+    suffixes.reserve(courseCount * 4);
+    const char* previous = nullptr;
+    size_t previousLength = 0;
+    size_t previousPrefix = 0;
+    unsigned int department = 0;
+    for (size_t id = 0; id < courseCount; id++) {
+        const char* key = catalog.keys[id].bytes;
+        const char* end = (const char*)memchr(key, '\0', COMPACT_KEY_WIDTH);
+        size_t length = end == nullptr ? COMPACT_KEY_WIDTH : (size_t)(end - key);
+        size_t prefix = 0;
+        while (prefix < length && isalpha((unsigned char)key[prefix])) {
+            prefix++;
+        }
+        if (previous == nullptr || prefix != previousPrefix || memcmp(key, previous, prefix) != 0) {
+            auto inserted = departmentIds.insert(make_pair(string(key, prefix), (unsigned int)departments.size()));
+            if (inserted.second) {
+                departments.push_back(inserted.first->first);
+            }
+            department = inserted.first->second;
+        }
+        keyDepartments[id] = department;
+
+        size_t shared = 0;
+        const char* suffix = key + prefix;
+        const char* previousSuffix = previous == nullptr ? nullptr : previous + previousPrefix;
+        size_t suffixLength = length - prefix;
+        while (previousSuffix != nullptr && shared < suffixLength && shared < previousLength - previousPrefix
+            && suffix[shared] == previousSuffix[shared]) {
+            shared++;
+        }
+        appendVarint(suffixes, (unsigned int)shared);
+        appendVarint(suffixes, (unsigned int)(suffixLength - shared));
+        suffixes.insert(suffixes.end(), suffix + shared, suffix + suffixLength);
+        previous = key;
+        previousLength = length;
+        previousPrefix = prefix;
+    }
+
+    vector<unsigned char>& dictionary = columns[COLUMN_DEPARTMENTS - 1];
+    vector<unsigned int> departmentOffsets(1, 0);
+    string departmentPool = "";
+    for (const string& department : departments) {
+        departmentPool += department;
+        departmentOffsets.push_back((unsigned int)departmentPool.size());
+    }
+    appendLittleEndian(dictionary, departments.size(), 4);
+    appendUint32Column(dictionary, departmentOffsets);
+    dictionary.insert(dictionary.end(), departmentPool.begin(), departmentPool.end());
+
+    int width = departments.size() <= 0x100 ? 1 : departments.size() <= 0x10000 ? 2 : 4;
+    vector<unsigned char>& ids = columns[COLUMN_DEPARTMENT_IDS - 1];
+    ids.resize(1 + courseCount * width);
+    ids[0] = (unsigned char)width;
+    for (size_t id = 0; id < courseCount; id++) {
+        for (int b = 0; b < width; b++) {
+            ids[1 + id * width + b] = (unsigned char)(keyDepartments[id] >> (8 * b));
+        }
+    }
+
+    // Names and edges are already offset-indexed columns in the compact catalog; on a little-endian
+    // host they are written straight from its memory
+    vector<pair<const unsigned char*, size_t>> views(COLUMN_COUNT);
+    views[COLUMN_NAMES - 1] = make_pair((const unsigned char*)catalog.namePool.data(), catalog.namePool.size());
+    const vector<unsigned int>* offsetColumns[3] = { &catalog.nameOffsets, &catalog.prerequisiteOffsets, &catalog.prerequisites };
+    const int offsetColumnIds[3] = { COLUMN_NAME_OFFSETS, COLUMN_PREREQUISITE_OFFSETS, COLUMN_PREREQUISITES };
+    for (int i = 0; i < 3; i++) {
+        vector<unsigned char>& column = columns[offsetColumnIds[i] - 1];
+        if (hostIsLittleEndian()) {
+            views[offsetColumnIds[i] - 1] = make_pair((const unsigned char*)offsetColumns[i]->data(), offsetColumns[i]->size() * 4);
+        }
+        else {
+            appendUint32Column(column, *offsetColumns[i]);
+        }
+    }
+    for (int column = 0; column < COLUMN_COUNT; column++) {
+        if (views[column].first == nullptr) {
+            views[column] = make_pair(columns[column].data(), columns[column].size());
+        }
+    }
+
+    // Header and column directory
+    vector<unsigned char> header(COLUMNAR_MAGIC, COLUMNAR_MAGIC + 4);
+    appendLittleEndian(header, COLUMNAR_VERSION, 4);
+    appendLittleEndian(header, courseCount, 4);
+    appendLittleEndian(header, catalog.prerequisites.size(), 4);
+    appendLittleEndian(header, COLUMN_COUNT, 4);
+    unsigned long long offset = COLUMNAR_HEADER_BYTES + COLUMN_COUNT * COLUMNAR_DIRECTORY_ENTRY_BYTES;
+    for (int column = 0; column < COLUMN_COUNT; column++) {
+        appendLittleEndian(header, column + 1, 4);
+        appendLittleEndian(header, crc32Bytes(views[column].first, views[column].second), 4);
+        appendLittleEndian(header, offset, 8);
+        appendLittleEndian(header, views[column].second, 8);
+        offset += views[column].second;
+    }
+
+    ofstream file(path, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        cout << "Error: Cannot write '" << path << "'" << endl;
+        return false;
+    }
+    file.write((const char*)header.data(), header.size());
+    for (const pair<const unsigned char*, size_t>& view : views) {
+        file.write((const char*)view.first, view.second);
+    }
+    file.close();
+    if (!file) {
+        cout << "Error: Failed writing '" << path << "'" << endl;
+        return false;
+    }
+    fileBytes = (size_t)offset;
+    return true;
+}
+
+/**
+ * Function: Import Columnar Catalog
+ * Purpose: Reads the projected columns of a columnar export into a compact catalog; columns
+ *          outside the projection are skipped with a seek and never read
+ * Input: path - export file, projection - PROJECT_* flags, catalog - reference to compact catalog
+ *        to fill (vectors of unprojected columns stay empty), bytesRead - reference receiving the
+ *        bytes read from the file
+ * Output: true if every projected column was read, passed its CRC check and decoded consistently
+ */
+bool importColumnarCatalog(const string& path, unsigned int projection, CompactCatalog& catalog, size_t& bytesRead) {
+    catalog = CompactCatalog();
+    bytesRead = 0;
+
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) {
+        cout << "Error: Cannot open file '" << path << "'" << endl;
+        return false;
+    }
+    file.seekg(0, ios::end);
+    unsigned long long fileSize = (unsigned long long)file.tellg();
+    file.seekg(0);
+
+    vector<unsigned char> header(COLUMNAR_HEADER_BYTES);
+    file.read((char*)header.data(), header.size());
+    if (!file || memcmp(header.data(), COLUMNAR_MAGIC, 4) != 0
+        || readLittleEndian(header.data() + 4, 4) != COLUMNAR_VERSION) {
+        cout << "Error: '" << path << "' is not a version " << COLUMNAR_VERSION << " columnar catalog" << endl;
+        return false;
+    }
+    size_t courseCount = (size_t)readLittleEndian(header.data() + 8, 4);
+    size_t edgeCount = (size_t)readLittleEndian(header.data() + 12, 4);
+    size_t columnCount = (size_t)readLittleEndian(header.data() + 16, 4);
+
+    // Nothing in the header is CRC-checked, so every count must fit the file before it sizes a buffer:
+    // each course stores at least a department id byte and each edge a u32
+    if (columnCount > (fileSize - COLUMNAR_HEADER_BYTES) / COLUMNAR_DIRECTORY_ENTRY_BYTES) {
+        cout << "Error: '" << path << "' has a truncated column directory" << endl;
+        return false;
+    }
+    if (courseCount > fileSize || edgeCount > fileSize / 4) {
+        cout << "Error: '" << path << "' has a damaged header" << endl;
+        return false;
+    }
+
+    vector<unsigned char> directory(columnCount * COLUMNAR_DIRECTORY_ENTRY_BYTES);
+    file.read((char*)directory.data(), directory.size());
+    if (!file) {
+        cout << "Error: '" << path << "' has a truncated column directory" << endl;
+        return false;
+    }
+    bytesRead = header.size() + directory.size();
+
+    // Finds one column by id; unknown columns from later versions are simply never asked for, and a
+    // column that runs past the end of the file counts as damaged before anything is sized from it
+    auto findColumn = [&](int column, unsigned long long& offset, size_t& length, unsigned int& crc) {
+        for (size_t i = 0; i < columnCount; i++) {
+            const unsigned char* entry = directory.data() + i * COLUMNAR_DIRECTORY_ENTRY_BYTES;
+            if (readLittleEndian(entry, 4) == (unsigned long long)column) {
+                crc = (unsigned int)readLittleEndian(entry + 4, 4);
+                offset = readLittleEndian(entry + 8, 8);
+                unsigned long long columnLength = readLittleEndian(entry + 16, 8);
+                if (offset > fileSize || columnLength > fileSize - offset) {
+                    return false;
+                }
+                length = (size_t)columnLength;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Reads a column straight into its destination and checks its CRC
+    auto readColumnInto = [&](unsigned char* destination, size_t length, unsigned int crc,
+        unsigned long long offset) {
+        file.seekg((streamoff)offset);
+        file.read((char*)destination, length);
+        bytesRead += length;
+        return file.good() && crc32Bytes(destination, length) == crc;
+    };
+
+    vector<unsigned char> bytes;
+    auto readColumn = [&](int column) {
+        unsigned long long offset = 0;
+        size_t length = 0;
+        unsigned int crc = 0;
+        if (!findColumn(column, offset, length, crc)) {
+            return false;
+        }
+        bytes.resize(length);
+        return readColumnInto(bytes.data(), length, crc, offset);
+    };
+
+    // u32 columns land in their vector without an intermediate buffer on little-endian hosts
+    auto readUint32Into = [&](int column, vector<unsigned int>& values) {
+        unsigned long long offset = 0;
+        size_t length = 0;
+        unsigned int crc = 0;
+        if (!hostIsLittleEndian()) {
+            return readColumn(column) && readUint32Column(bytes.data(), bytes.size(), values);
+        }
+        if (!findColumn(column, offset, length, crc) || length % 4 != 0) {
+            return false;
+        }
+        values.resize(length / 4);
+        return readColumnInto((unsigned char*)values.data(), length, crc, offset);
+    };
+
+    bool ok = true;
+    if (projection & PROJECT_KEYS) {
+        // Department dictionary, then one prefix id and one front-coded suffix per course
+        vector<string> departments;
+        ok = readColumn(COLUMN_DEPARTMENTS) && bytes.size() >= 4;
+        if (ok) {
+            size_t count = (size_t)readLittleEndian(bytes.data(), 4);
+            vector<unsigned int> offsets;
+            ok = bytes.size() >= 4 + (count + 1) * 4 && readUint32Column(bytes.data() + 4, (count + 1) * 4, offsets);
+            size_t pool = 4 + (count + 1) * 4;
+            for (size_t i = 0; ok && i < count; i++) {
+                ok = offsets[i] <= offsets[i + 1] && pool + offsets[i + 1] <= bytes.size()
+                    && offsets[i + 1] - offsets[i] <= COMPACT_KEY_WIDTH;
+                if (ok) {
+                    departments.push_back(string((const char*)bytes.data() + pool + offsets[i], offsets[i + 1] - offsets[i]));
+                }
+            }
+        }
+
+        vector<unsigned int> keyDepartments(courseCount);
+        ok = ok && readColumn(COLUMN_DEPARTMENT_IDS) && !bytes.empty();
+        if (ok) {
+            int width = bytes[0];
+            ok = (width == 1 || width == 2 || width == 4) && bytes.size() == 1 + courseCount * width;
+            for (size_t id = 0; ok && id < courseCount; id++) {
+                const unsigned char* value = bytes.data() + 1 + id * width;
+                keyDepartments[id] = width == 1 ? value[0] : (unsigned int)readLittleEndian(value, width);
+                ok = keyDepartments[id] < departments.size();
+            }
+        }
+
+        // Keys are rebuilt in place: department bytes, then the shared part of the previous suffix, then the rest
+        ok = ok && readColumn(COLUMN_KEY_SUFFIXES);
+        if (ok) {
+            catalog.keys.resize(courseCount);
+            char suffix[COMPACT_KEY_WIDTH];
+            size_t suffixLength = 0;
+            size_t offset = 0;
+            for (size_t id = 0; ok && id < courseCount; id++) {
+                size_t shared = readVarint(bytes, offset);
+                size_t length = readVarint(bytes, offset);
+                const string& department = departments[keyDepartments[id]];
+                ok = shared <= suffixLength && offset + length <= bytes.size()
+                    && department.size() + shared + length <= COMPACT_KEY_WIDTH;
+                if (ok) {
+                    memcpy(suffix + shared, bytes.data() + offset, length);
+                    suffixLength = shared + length;
+                    offset += length;
+                    PackedKey& key = catalog.keys[id];
+                    memset(key.bytes, 0, COMPACT_KEY_WIDTH);
+                    memcpy(key.bytes, department.data(), department.size());
+                    memcpy(key.bytes + department.size(), suffix, suffixLength);
+                }
+            }
+        }
+    }
+
+    if (ok && (projection & PROJECT_NAMES)) {
+        ok = readUint32Into(COLUMN_NAME_OFFSETS, catalog.nameOffsets) && catalog.nameOffsets.size() == courseCount + 1
+            && is_sorted(catalog.nameOffsets.begin(), catalog.nameOffsets.end());
+        unsigned long long offset = 0;
+        size_t length = 0;
+        unsigned int crc = 0;
+        ok = ok && findColumn(COLUMN_NAMES, offset, length, crc) && length == catalog.nameOffsets.back();
+        if (ok) {
+            catalog.namePool.resize(length);
+            ok = length == 0 || readColumnInto((unsigned char*)&catalog.namePool[0], length, crc, offset);
+        }
+    }
+
+    if (ok && (projection & PROJECT_PREREQUISITES)) {
+        ok = readUint32Into(COLUMN_PREREQUISITE_OFFSETS, catalog.prerequisiteOffsets)
+            && catalog.prerequisiteOffsets.size() == courseCount + 1 && catalog.prerequisiteOffsets.back() == edgeCount
+            && is_sorted(catalog.prerequisiteOffsets.begin(), catalog.prerequisiteOffsets.end());
+        ok = ok && readUint32Into(COLUMN_PREREQUISITES, catalog.prerequisites) && catalog.prerequisites.size() == edgeCount;
+        for (size_t i = 0; ok && i < edgeCount; i++) {
+            ok = catalog.prerequisites[i] < courseCount;
+        }
+    }
+
+    if (!ok) {
+        cout << "Error: '" << path << "' has a missing or damaged column" << endl;
+        catalog = CompactCatalog();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Trims leading/trailing whitespace and quotes from filename
+ */
+string trimFilename(const string& filename) {
+    size_t start = filename.find_first_not_of(" \t\"'");
+    size_t end = filename.find_last_not_of(" \t\"'");
+
+    if (start != string::npos && end != string::npos) {
+        return filename.substr(start, end - start + 1);
+    }
+    return filename;
+}
+
+/**
+ * Validates if filename has .csv extension (case insensitive)
+ */
+bool isValidCsvExtension(const string& filename) {
+    if (filename.length() < 4) {
+        return false;
+    }
+
+    string extension = filename.substr(filename.length() - 4);
+    return (extension == ".csv" || extension == ".CSV");
+}
+
+/**
+ * Checks if file exists and can be opened
+ */
+bool fileExists(const string& filename) {
+    ifstream file(filename);
+    bool exists = file.is_open();
+    if (exists) {
+        file.close();
+    }
+    return exists;
+}
+
+/**
+ * Checks if a path names a directory
+ */
+bool isDirectory(const string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && (info.st_mode & S_IFDIR) != 0;
+}
+
+/**
+ * Function: List Catalog Directory
+ * Purpose: Finds every .csv file directly inside a directory
+ * Input: directory - path to scan, files - reference to vector receiving the paths in name order
+ * Output: true if the directory could be read
+ */
+bool listCatalogDirectory(const string& directory, vector<string>& files) {
+    vector<string> names;
+#ifdef _WIN32
+    WIN32_FIND_DATAA entry;
+    HANDLE search = FindFirstFileA((directory + "\\*.csv").c_str(), &entry);
+    if (search == INVALID_HANDLE_VALUE) {
+        return GetLastError() == ERROR_FILE_NOT_FOUND;
+    }
+    do {
+        if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0) {
+            names.push_back(entry.cFileName);
+        }
+    } while (FindNextFileA(search, &entry));
+    FindClose(search);
+#else
+    DIR* handle = opendir(directory.c_str());
+    if (handle == nullptr) {
+        return false;
+    }
+    for (dirent* entry = readdir(handle); entry != nullptr; entry = readdir(handle)) {
+        string name = entry->d_name;
+        if (isValidCsvExtension(name) && !isDirectory(directory + "/" + name)) {
+            names.push_back(name);
+        }
+    }
+    closedir(handle);
+#endif
+
+    sort(names.begin(), names.end());
+    string separator = directory.back() == '/' || directory.back() == '\\' ? "" : "/";
+    for (const string& name : names) {
+        files.push_back(directory + separator + name);
+    }
+    return true;
+}
+
+/**
+ * Function: Expand Catalog Sources
+ * Purpose: Turns user input into the list of catalog files to load
+ * Input: input - one .csv file, a directory of .csv files, or several of either separated by ';',
+ *        files - reference to vector receiving the catalog paths in load order
+ * Output: true if every entry names a readable .csv file or a directory containing .csv files
+ */
+bool expandCatalogSources(const string& input, vector<string>& files) {
+    files.clear();
+    size_t start = 0;
+
+    while (start <= input.size()) {
+        size_t end = input.find(';', start);
+        if (end == string::npos) {
+            end = input.size();
+        }
+        string source = trimFilename(input.substr(start, end - start));
+        start = end + 1;
+
+        if (source.empty()) {
+            continue;
+        }
+
+        if (isDirectory(source)) {
+            size_t before = files.size();
+            if (!listCatalogDirectory(source, files)) {
+                cout << "Error: Cannot read directory '" << source << "'" << endl;
+                return false;
+            }
+            if (files.size() == before) {
+                cout << "Error: No .csv files found in directory '" << source << "'" << endl;
+                return false;
+            }
+            continue;
+        }
+
+        // Validate CSV extension
+        if (!isValidCsvExtension(source)) {
+            cout << "Error: File must have .csv extension" << endl;
+            return false;
+        }
+
+        // Check if file exists
+        if (!fileExists(source)) {
+            cout << "Error: Cannot open file '" << source << "'" << endl;
+            return false;
+        }
+
+        files.push_back(source);
+    }
+
+    if (files.empty()) {
+        cout << "Error: Filename cannot be empty" << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * One catalog file read by the multi-catalog loader
+ */
+struct CatalogFile {
+    string filename;            // Path of the catalog file
+    vector<string> lines;       // Non-empty lines (moved out once validation has them)
+    vector<size_t> lineNumbers; // 1-based file line of each entry
+    vector<Course> courses;     // Course per line (empty course number if the line did not parse)
+    bool readOk = false;        // File was opened and had data
+    double seconds = 0.0;       // Time spent reading and parsing this file
+};
+
+/**
+ * Function: Read Catalog Files
+ * Purpose: Reads (and optionally parses) several catalog files concurrently, largest file first
+ * Input: files - catalog paths, catalogs - reference to vector receiving one entry per file in the
+ *        same order, parseCourses - also build Course objects, threads - worker count (0 = hardware concurrency)
+ * Output: true if every file was read
+ */
+bool readCatalogFiles(const vector<string>& files, vector<CatalogFile>& catalogs, bool parseCourses,
+    unsigned int threads = 0) {
+    catalogs.clear();
+    catalogs.resize(files.size());
+
+    // Start the biggest files first so the last one to finish is not a large file started late
+    vector<pair<long long, size_t>> bySize;
+    for (size_t i = 0; i < files.size(); i++) {
+        struct stat info;
+        bySize.push_back(make_pair(stat(files[i].c_str(), &info) == 0 ? (long long)info.st_size : 0LL, i));
+    }
+    sort(bySize.begin(), bySize.end(), [](const pair<long long, size_t>& a, const pair<long long, size_t>& b) {
+        return a.first > b.first;
+    });
+
+    runTaskPool(files.size(), threads, [&](size_t task) {
+        CatalogFile& catalog = catalogs[bySize[task].second];
+        auto start = chrono::steady_clock::now();
+
+        catalog.filename = files[bySize[task].second];
+        catalog.readOk = readFileLines(catalog.filename, catalog.lines, &catalog.lineNumbers);
+        if (catalog.readOk && parseCourses) {
+            catalog.courses.resize(catalog.lines.size());
+            for (size_t i = 0; i < catalog.lines.size(); i++) {
+                if (!createCourseObject(catalog.lines[i], catalog.courses[i])) {
+                    catalog.courses[i] = Course();
+                }
+            }
+        }
+
+        catalog.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    });
+
+    for (const CatalogFile& catalog : catalogs) {
+        if (!catalog.readOk) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Function: Concatenate Catalogs
+ * Purpose: Moves every file's lines into one list so they can be validated together
+ * Input: catalogs - files read by readCatalogFiles (their lines are moved out),
+ *        lines, lineNumbers - references receiving all rows, sources - reference receiving each file's row range
+ */
+void concatenateCatalogs(vector<CatalogFile>& catalogs, vector<string>& lines, vector<size_t>& lineNumbers,
+    RowSources& sources) {
+    size_t total = 0;
+    for (const CatalogFile& catalog : catalogs) {
+        total += catalog.lines.size();
+    }
+    lines.clear();
+    lineNumbers.clear();
+    lines.reserve(total);
+    lineNumbers.reserve(total);
+    sources = RowSources();
+
+    for (CatalogFile& catalog : catalogs) {
+        sources.names.push_back(catalog.filename);
+        sources.firstRow.push_back(lines.size());
+        for (string& line : catalog.lines) {
+            lines.push_back(move(line));
+        }
+        lineNumbers.insert(lineNumbers.end(), catalog.lineNumbers.begin(), catalog.lineNumbers.end());
+        vector<string>().swap(catalog.lines);
+    }
+}
+
+/**
+ * Function: Merge Catalog Courses
+ * Purpose: Inserts every parsed course into one hash table in parallel; each worker owns a
+ *          disjoint set of buckets, and files are applied in load order so later rows replace earlier ones
+ * Input: catalogs - files with parsed courses, table - reference to hash table to fill,
+ *        threads - worker count (0 = hardware concurrency)
+ * Output: table holds every course; returns the number of courses that were not already present
+ */
+int mergeCatalogCourses(const vector<CatalogFile>& catalogs, HashTable& table, unsigned int threads = 0) {
+    INSTRUMENT_SCOPE(OP_INSERT);
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+
+    // Grow once up front so no resize happens while workers fill buckets
+    size_t total = 0;
+    for (const CatalogFile& catalog : catalogs) {
+        total += catalog.courses.size();
+    }
+    while ((double)(table.size + total) / table.capacity > table.maxLoadFactor) {
+        resizeHashTable(table);
+    }
+
+    // Bucket of every course, grouped per file by the worker that owns the bucket
+    vector<vector<vector<size_t>>> owned(catalogs.size(), vector<vector<size_t>>(threads));
+    vector<vector<int>> buckets(catalogs.size());
+    runTaskPool(catalogs.size(), threads, [&](size_t file) {
+        const vector<Course>& courses = catalogs[file].courses;
+        buckets[file].resize(courses.size());
+        for (size_t i = 0; i < courses.size(); i++) {
+            if (courses[i].courseNumber.empty()) {
+                continue;
+            }
+            buckets[file][i] = hashFunction(courses[i].courseNumber, table.capacity);
+            owned[file][buckets[file][i] % threads].push_back(i);
+        }
+    });
+
+    vector<int> added(threads, 0);
+    runInParallel(threads, threads, [&](unsigned int worker, size_t, size_t) {
+        for (size_t file = 0; file < catalogs.size(); file++) {
+            for (size_t i : owned[file][worker]) {
+                if (insertCourseIntoBucket(table, buckets[file][i], catalogs[file].courses[i])) {
+                    added[worker]++;
+                }
+            }
+        }
+    });
+
+    int newCourses = 0;
+    for (int count : added) {
+        newCourses += count;
+    }
+    table.size = table.size + newCourses;
+    return newCourses;
+}
+
+/**
+ * Function: Report Load Validation
+ * Purpose: Prints what the collect-all validator found during a load
+ * Input: valid - validator result, issues - issues it reported
+ * Output: true if the load may continue
+ */
+bool reportLoadValidation(bool valid, const vector<ValidationIssue>& issues) {
+    if (!valid) {
+        printValidationIssues(issues, 50);
+        cout << "Failed to load courses from file. Please check the file format and try again." << endl;
+        cout << "Use option 7 to write the full validation report." << endl;
+        return false;
+    }
+    if (!issues.empty()) {
+        // Duplicates overwrite earlier rows and cycles are allowed, as before; just warn
+        cout << "Warning: " << issues.size() << " duplicate/cycle finding(s):" << endl;
+        printValidationIssues(issues, 10);
+    }
+    return true;
+}
+
+/**
+ * Function: Load Catalog Files
+ * Purpose: Loads several catalog files concurrently into one hash table. Files are read and parsed
+ *          on a thread pool, prerequisites are resolved across all files once every file is read,
+ *          and the courses are merged in parallel
+ * Input: files - catalog paths in load order (later files replace duplicate courses of earlier ones),
+ *        table - reference to hash table to populate, threads - worker count (0 = hardware concurrency)
+ * Output: true if every file was read and the combined catalog passed validation;
+ *         prints per-file row counts and timings
+ */
+bool loadCatalogFiles(const vector<string>& files, HashTable& table, unsigned int threads = 0) {
+    INSTRUMENT_PHASE_START(phaseTimer);
+    auto start = chrono::steady_clock::now();
+
+    // Step 1: Read and parse every file concurrently
+    vector<CatalogFile> catalogs;
+    if (!readCatalogFiles(files, catalogs, true, threads)) {
+        return false;
+    }
+    double readSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    INSTRUMENT_PHASE_LAP(phaseTimer, PHASE_READ);
+
+    // Step 2: Validate all rows together so prerequisites may name courses from any file
+    vector<string> lines;
+    vector<size_t> lineNumbers;
+    RowSources sources;
+    concatenateCatalogs(catalogs, lines, lineNumbers, sources);
+
+    vector<ValidationIssue> issues;
+    bool valid;
+    {
+        INSTRUMENT_SCOPE(OP_VALIDATE);
+        valid = validateFileCollectAll(lines, lineNumbers, issues, threads, &sources);
+    }
+    vector<string>().swap(lines);
+    if (!reportLoadValidation(valid, issues)) {
+        return false;
+    }
+    INSTRUMENT_PHASE_LAP(phaseTimer, PHASE_VALIDATE);
+
+    // Step 3: Merge every file's courses into the table
+    mergeCatalogCourses(catalogs, table, threads);
+    INSTRUMENT_PHASE_LAP(phaseTimer, PHASE_INSERT);
+    double totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Per-file report
+    ios::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    double largest = 0.0;
+    double sum = 0.0;
+    size_t rows = 0;
+    cout << endl << left << setw(40) << "Catalog file" << right << setw(10) << "Rows" << setw(12) << "Read ms" << endl;
+    for (const CatalogFile& catalog : catalogs) {
+        cout << left << setw(40) << catalog.filename << right << setw(10) << catalog.lineNumbers.size()
+            << setw(12) << fixed << setprecision(1) << catalog.seconds * 1000.0 << endl;
+        largest = max(largest, catalog.seconds);
+        sum += catalog.seconds;
+        rows += catalog.lineNumbers.size();
+    }
+    cout << left << setw(40) << "Total" << right << setw(10) << rows << endl;
+    cout << "Read " << catalogs.size() << " files in " << readSeconds * 1000.0 << " ms (largest file "
+        << largest * 1000.0 << " ms, all files back to back " << sum * 1000.0 << " ms)" << endl;
+    cout << "Total load time: " << totalSeconds * 1000.0 << " ms" << endl;
+    cout.flags(flags);
+    cout.precision(precision);
+    return true;
+}
+
+/**
+ * Raw text handed from the reader to the parser: whole lines only
+ */
+struct TextBlock {
+    string text;          // One or more complete lines (the last block may lack a final newline)
+    size_t firstLine = 1; // 1-based file line of the first line in text
+};
+
+/**
+ * Rows handed from the parser to the inserter
+ */
+struct ParsedBlock {
+    vector<ParsedRow> rows;          // Rows with a course number (rows without a name are not inserted)
+    vector<string> names;            // Course name of each row
+    vector<size_t> lineNumbers;      // File line of each row
+    vector<ValidationIssue> issues;  // Format errors found in the block
+    size_t bytes = 0;                // Size of the text block the rows came from
+};
+
+/**
+ * What a streamed load did
+ */
+struct StreamLoadStats {
+    unsigned long long bytes = 0;    // File bytes read
+    size_t blocks = 0;               // Text blocks passed through the pipeline
+    size_t rows = 0;                 // Rows inserted (including duplicates)
+    size_t readerWaits = 0;          // Blocks the reader held back because the parser was behind
+    size_t parserWaits = 0;          // Blocks the parser held back because the inserter was behind
+    size_t peakBufferedBytes = 0;    // Most file bytes held in the pipeline at once
+    double pipelineSeconds = 0.0;    // Read + parse + insert, overlapped
+    double readerSeconds = 0.0;      // Reader thread busy time (excludes waits on a full queue)
+    double parserSeconds = 0.0;      // Parser thread busy time (excludes waits on either queue)
+    double inserterSeconds = 0.0;    // Inserting thread busy time (excludes waits for parsed rows)
+    double checkSeconds = 0.0;       // Dangling prerequisite and cycle checks afterwards
+};
+
+/**
+ * Function: Stream Catalog File
+ * Purpose: Loads one catalog through a three-stage pipeline: a reader thread cuts the file into
+ *          blocks of whole lines, a parser thread splits them into rows, and the calling thread
+ *          inserts the rows. Stages are joined by bounded lock-free queues, so at most a few blocks
+ *          are in memory whatever the file size; prerequisites that point ahead in the file and
+ *          cycles are checked once the pipeline drains, with the same findings validateFileCollectAll
+ *          reports for the file
+ * Input: filename - catalog file, table - reference to hash table receiving the courses,
+ *        issues - reference to vector receiving every finding sorted by line and column,
+ *        stats - reference to pipeline measurements
+ * Output: true if the file was read and has no format or dangling errors (table holds
+ *         whatever was inserted either way; the caller discards it on failure)
+ */
+bool streamCatalogFile(const string& filename, HashTable& table, vector<ValidationIssue>& issues,
+    StreamLoadStats& stats) {
+    issues.clear();
+    stats = StreamLoadStats();
+
+    ifstream file(filename, ios::binary);
+    if (!file.is_open()) {
+        cout << "Error: Cannot open file '" << filename << "'" << endl;
+        return false;
+    }
+
+    // The file size gives a rough row count for presizing the course id map
+    file.seekg(0, ios::end);
+    streamoff fileBytes = max<streamoff>(0, file.tellg());
+    file.seekg(0, ios::beg);
+
+    BoundedQueue<TextBlock> textQueue;
+    BoundedQueue<ParsedBlock> rowQueue;
+    textQueue.slots.resize(STREAM_QUEUE_BLOCKS);
+    rowQueue.slots.resize(STREAM_QUEUE_BLOCKS);
+    atomic<size_t> bufferedBytes(0);
+    atomic<size_t> peakBufferedBytes(0);
+    bool readError = false;
+    auto start = chrono::steady_clock::now();
+
+    // Stage 1: read fixed-size blocks, carrying a partial last line into the next block
+    thread reader([&]() {
+        INSTRUMENT_SCOPE(OP_READ_FILE);
+        string carry;
+        size_t line = 1;
+        auto busyStart = chrono::steady_clock::now();
+        while (file) {
+            TextBlock block;
+            block.text.swap(carry);
+            size_t kept = block.text.size();
+            block.text.resize(kept + STREAM_BLOCK_BYTES);
+            file.read(&block.text[kept], STREAM_BLOCK_BYTES);
+            block.text.resize(kept + (size_t)file.gcount());
+            stats.bytes += (unsigned long long)file.gcount();
+
+            size_t cut = block.text.rfind('\n');
+            if (file && cut == string::npos) {
+                carry.swap(block.text); // One line longer than a block: keep reading
+                continue;
+            }
+            if (file) {
+                carry.assign(block.text, cut + 1, string::npos);
+                block.text.resize(cut + 1);
+            }
+            if (block.text.empty()) {
+                continue;
+            }
+
+            block.firstLine = line;
+            line += count(block.text.begin(), block.text.end(), '\n');
+            size_t buffered = bufferedBytes += block.text.size();
+            size_t peak = peakBufferedBytes.load();
+            while (buffered > peak && !peakBufferedBytes.compare_exchange_weak(peak, buffered)) {
+            }
+            stats.readerSeconds += chrono::duration<double>(chrono::steady_clock::now() - busyStart).count();
+            queuePush(textQueue, block);
+            busyStart = chrono::steady_clock::now();
+        }
+        stats.readerSeconds += chrono::duration<double>(chrono::steady_clock::now() - busyStart).count();
+        readError = file.bad();
+        queueClose(textQueue);
+    });
+
+    // Stage 2: split blocks into rows; rows missing a course number or a name are format errors
+    thread parser([&]() {
+        TextBlock block;
+        while (queuePop(textQueue, block)) {
+            auto busyStart = chrono::steady_clock::now();
+            ParsedBlock parsed;
+            parsed.bytes = block.text.size();
+            size_t lineNumber = block.firstLine;
+            size_t begin = 0;
+            string line;
+            while (begin < block.text.size()) {
+                size_t end = block.text.find('\n', begin);
+                if (end == string::npos) {
+                    end = block.text.size();
+                }
+                line.assign(block.text, begin, end - begin);
+                begin = end + 1;
+
+                if (line.find_first_not_of(" \t\r") == string::npos) {
+                    lineNumber++;
+                    continue;
+                }
+                ParsedRow row;
+                string name;
+                {
+                    INSTRUMENT_SAMPLED_SCOPE(OP_PARSE);
+                    parseRowWithColumns(line, row, &name);
+                }
+                if (row.courseNumber.empty()) {
+                    parsed.issues.push_back(makeValidationIssue(lineNumber, 1, "format",
+                        "Unable to parse line '" + line + "'"));
+                }
+                else {
+                    // A row without a name still defines its course number for the checks, as in validateFileCollectAll
+                    if (!row.hasName) {
+                        parsed.issues.push_back(makeValidationIssue(lineNumber, row.courseColumn, "format",
+                            "Line '" + line + "' does not have minimum required parameters"));
+                    }
+                    parsed.rows.push_back(move(row));
+                    parsed.names.push_back(move(name));
+                    parsed.lineNumbers.push_back(lineNumber);
+                }
+                lineNumber++;
+            }
+            stats.parserSeconds += chrono::duration<double>(chrono::steady_clock::now() - busyStart).count();
+            queuePush(rowQueue, parsed);
+        }
+        queueClose(rowQueue);
+    });
+
+    // Stage 3 (this thread): insert rows and number each course by its first row, so the checks below see
+    // the same graph validateFileCollectAll builds (edges from every row, prerequisites resolved to first rows)
+    struct ForwardReference {
+        size_t course;         // Id of the course naming the prerequisite
+        string prerequisite;   // Course not seen yet when the row was read
+        size_t lineNumber;     // Row of the reference
+        size_t column;         // Column of the prerequisite
+    };
+    vector<ForwardReference> forwardReferences;
+    unordered_map<string, size_t> courseIds;     // Course number -> id (order of first row)
+    vector<const string*> courseNumbers;         // Id -> course number (keys of courseIds)
+    vector<pair<size_t, size_t>> firstRows;      // Id -> (line, column) of the first row
+    vector<vector<pair<size_t, size_t>>> edges(1);
+    courseIds.reserve((size_t)fileBytes / STREAM_BYTES_PER_ROW_ESTIMATE);
+    ParsedBlock parsed;
+    while (queuePop(rowQueue, parsed)) {
+        auto busyStart = chrono::steady_clock::now();
+        stats.blocks++;
+        issues.insert(issues.end(), parsed.issues.begin(), parsed.issues.end());
+        for (size_t i = 0; i < parsed.rows.size(); i++) {
+            ParsedRow& row = parsed.rows[i];
+            size_t lineNumber = parsed.lineNumbers[i];
+            auto defined = courseIds.insert(make_pair(row.courseNumber, courseNumbers.size()));
+            size_t id = defined.first->second;
+            if (defined.second) {
+                courseNumbers.push_back(&defined.first->first);
+                firstRows.push_back(make_pair(lineNumber, row.courseColumn));
+            }
+            else {
+                issues.push_back(makeValidationIssue(lineNumber, row.courseColumn, "duplicate",
+                    "Course '" + row.courseNumber + "' is already defined on line " + to_string(firstRows[id].first)));
+            }
+
+            for (size_t p = 0; p < row.prerequisites.size(); p++) {
+                auto found = courseIds.find(row.prerequisites[p]);
+                if (found != courseIds.end()) {
+                    edges[0].push_back(make_pair(id, found->second));
+                }
+                else {
+                    forwardReferences.push_back({ id, row.prerequisites[p], lineNumber, row.prerequisiteColumns[p] });
+                }
+            }
+
+            if (row.hasName) {
+                // Later rows replace earlier ones, as on any load
+                Course course;
+                course.courseNumber = row.courseNumber;
+                course.name = move(parsed.names[i]);
+                course.prerequisites = move(row.prerequisites);
+                insertCourseIntoTable(table, move(course));
+                stats.rows++;
+            }
+        }
+        bufferedBytes -= parsed.bytes;
+        stats.inserterSeconds += chrono::duration<double>(chrono::steady_clock::now() - busyStart).count();
+    }
+    reader.join();
+    parser.join();
+    stats.readerWaits = textQueue.fullWaits;
+    stats.parserWaits = rowQueue.fullWaits;
+    stats.peakBufferedBytes = peakBufferedBytes.load();
+    stats.pipelineSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    INSTRUMENT_PHASE_MEMORY(PHASE_INSERT);
+
+    if (readError) {
+        cout << "Error: Failed reading '" << filename << "'" << endl;
+        return false;
+    }
+    if (stats.rows == 0 && issues.empty()) {
+        cout << "Error: File is empty or contains no valid data" << endl;
+        return false;
+    }
+
+    // Forward references must name a course somewhere in the file; these checks count as one validateFile call
+    start = chrono::steady_clock::now();
+    {
+        INSTRUMENT_SCOPE(OP_VALIDATE);
+        for (const ForwardReference& reference : forwardReferences) {
+            auto found = courseIds.find(reference.prerequisite);
+            if (found == courseIds.end()) {
+                issues.push_back(makeValidationIssue(reference.lineNumber, reference.column, "dangling",
+                    "Prerequisite '" + reference.prerequisite + "' in course '" + *courseNumbers[reference.course]
+                    + "' does not exist as a course"));
+            }
+            else {
+                edges[0].push_back(make_pair(reference.course, found->second));
+            }
+        }
+        vector<ForwardReference>().swap(forwardReferences);
+
+        // Cycles are reported at the first row of their earliest course, as option 7 does
+        vector<size_t> edgeOffsets;
+        vector<size_t> edgeTargets;
+        buildPrerequisiteGraph(edges, courseNumbers.size(), edgeOffsets, edgeTargets);
+        vector<vector<pair<size_t, size_t>>>().swap(edges);
+        findCycleComponents(courseNumbers.size(), edgeOffsets, edgeTargets, [&](const vector<size_t>& component) {
+            string message = describePrerequisiteCycle(component, [&courseNumbers](size_t id) -> const string& {
+                return *courseNumbers[id];
+            });
+            issues.push_back(makeValidationIssue(firstRows[component[0]].first, firstRows[component[0]].second, "cycle",
+                message));
+        });
+    }
+    stats.checkSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    INSTRUMENT_PHASE_MEMORY(PHASE_VALIDATE);
+
+    bool valid = true;
+    for (const ValidationIssue& issue : issues) {
+        if (issue.kind == "format" || issue.kind == "dangling") {
+            valid = false;
+        }
+    }
+    sort(issues.begin(), issues.end(), [](const ValidationIssue& a, const ValidationIssue& b) {
+        if (a.lineNumber != b.lineNumber) {
+            return a.lineNumber < b.lineNumber;
+        }
+        if (a.column != b.column) {
+            return a.column < b.column;
+        }
+        return a.message < b.message;
+    });
+    return valid;
+}
+
+/**
+ * Gets raw filename input from user
+ */
+string getUserInput() {
+    string filename;
+    cout << "Enter a .csv file or a directory of .csv files (separate several with ';')";
+    if (EMBEDDED_COURSE_COUNT > 0) {
+        cout << ", or press Enter for the built-in catalog";
+    }
+    cout << ": ";
+    getline(cin, filename);
+    return filename;
+}
+
+/**
+ * Prompts user for a catalog file, directory or ';'-separated list and validates
+ * that every file exists and is CSV format
+ * Keeps asking until valid input is provided
+ * Returns the input when every catalog file is found
+ */
+string getValidFilename() {
+    while (true) {
+        string filename = getUserInput();
+
+        // Check if filename is empty (kiosk builds use the built-in catalog instead)
+        if (filename.empty() && EMBEDDED_COURSE_COUNT > 0) {
+            cout << "Using the built-in catalog: " << EMBEDDED_COURSE_COUNT << " courses from "
+                << EMBEDDED_CATALOG_SOURCE << endl;
+            return filename;
+        }
+        if (filename.empty()) {
+            cout << "Error: Filename cannot be empty" << endl;
+            continue;
+        }
+
+        // Clean the filename
+        filename = trimFilename(filename);
+
+        // Check the extension and existence of every file (directories expand to their .csv files)
+        vector<string> files;
+        if (!expandCatalogSources(filename, files)) {
+            continue;
+        }
+
+        if (files.size() == 1) {
+            cout << "CSV file '" << files[0] << "' found successfully!" << endl;
+        }
+        else {
+            cout << files.size() << " CSV files found successfully!" << endl;
+        }
+        return filename;
+    }
+}
+
+/**
+ * Displays the main menu options
+ */
+void displayMenu() {
+    cout << endl;
+    cout << "1. Load Data Structure." << endl;
+    cout << "2. Print Course List." << endl;
+    cout << "3. Print Course." << endl;
+    cout << "4. Search Course Names." << endl;
+    cout << "5. Show Dependent Courses." << endl;
+    cout << "6. Show Runtime Statistics." << endl;
+    cout << "7. Validate File (report all errors)." << endl;
+    cout << "8. Edit Course (add/update/remove)." << endl;
+    cout << "10. Export Catalog (columnar file)." << endl;
+    cout << "11. Show Memory Report." << endl;
+    cout << "9. Exit" << endl;
+    cout << "What would you like to do? ";
+}
+
+/**
+ * Validates menu choice input
+ */
+bool isValidMenuChoice(const string& choice) {
+    return (choice == "1" || choice == "2" || choice == "3" || choice == "4" || choice == "5" || choice == "6" || choice == "7" || choice == "8" || choice == "9" || choice == "10" || choice == "11");
+}
+
+/**
+ * Gets and validates menu choice from user
+ */
+string getMenuChoice() {
+    string choice;
+    getline(cin, choice);
+    return choice;
+}
+
+/**
+ * Function: Rebuild Course Indexes
+ * Purpose: Rebuilds every secondary structure after the table changed outside a load
+ * Input: table - hash table containing courses, nameIndex, suggestionIndex, dependencyIndex,
+ *        compactCatalog - references to the structures to rebuild
+ */
+void rebuildCourseIndexes(const HashTable& table, NameIndex& nameIndex, SuggestionIndex& suggestionIndex,
+    DependencyIndex& dependencyIndex, CompactCatalog& compactCatalog) {
+    buildNameIndex(table, nameIndex);
+    buildSuggestionIndex(table, suggestionIndex);
+    buildDependencyIndex(table, dependencyIndex);
+    buildCompactCatalog(table, compactCatalog);
+}
+
+/**
+ * Function: Load Catalog Source
+ * Purpose: Runs the read, validate and insert steps of a load for one catalog source
+ * Input: filename - catalog file, directory or ';'-separated list (empty = the built-in catalog),
+ *        table - reference to hash table to populate
+ * Output: true if the courses were inserted; errors are printed and the load stops at the failing step
+ */
+bool loadCatalogSource(const string& filename, HashTable& table) {
+    vector<string> files;
+    if (filename.empty()) {
+        // Built-in catalog: validated when the header was generated, so only the copy remains
+        if (!loadEmbeddedCatalog(table)) {
+            return false;
+        }
+    }
+    else if (!expandCatalogSources(filename, files)) {
+        return false;
+    }
+    else if (files.size() > 1) {
+        // Steps 1-3 for several catalogs: concurrent read, combined validation, parallel merge
+        if (!loadCatalogFiles(files, table)) {
+            return false;
+        }
+    }
+    else {
+        // Steps 1-3 for one file: read, parse and insert overlap in a pipeline whose memory is bounded,
+        // and the courses go into a separate table so a file that fails validation changes nothing
+        HashTable streamed = initializeHashTable(16);
+        streamed.verbose = table.verbose;
+        vector<ValidationIssue> issues;
+        StreamLoadStats stats;
+        bool valid = streamCatalogFile(files[0], streamed, issues, stats);
+        INSTRUMENT_PHASE_RECORD(PHASE_READ, stats.readerSeconds);
+        INSTRUMENT_PHASE_RECORD(PHASE_INSERT, stats.parserSeconds + stats.inserterSeconds);
+        INSTRUMENT_PHASE_RECORD(PHASE_VALIDATE, stats.checkSeconds);
+        INSTRUMENT_PHASE_OVERLAP(stats.pipelineSeconds);
+
+        streamed.verbose = false;
+        if ((!valid && issues.empty()) || !reportLoadValidation(valid, issues)) {
+            cleanupHashTable(streamed);
+            return false;
+        }
+
+        ios::fmtflags flags = cout.flags();
+        streamsize precision = cout.precision();
+        cout << fixed << setprecision(1) << "Streamed " << formatByteCount(stats.bytes) << " in "
+            << stats.pipelineSeconds * 1000.0 << " ms (" << stats.blocks << " blocks, at most "
+            << formatByteCount(stats.peakBufferedBytes) << " buffered; reader held back " << stats.readerWaits
+            << "x, parser held back " << stats.parserWaits << "x)" << endl;
+        cout.flags(flags);
+        cout.precision(precision);
+
+        if (table.size == 0) {
+            streamed.verbose = table.verbose;
+            table.verbose = false;
+            cleanupHashTable(table);
+            table = streamed;
+        }
+        else {
+            // Reloading over loaded courses: later rows replace earlier ones, as before
+            for (int i = 0; i < streamed.capacity; i++) {
+                for (HashNode* current = streamed.buckets[i]; current != nullptr; current = current->next) {
+                    insertCourseIntoTable(table, move(current->course));
+                }
+            }
+            cleanupHashTable(streamed);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Function: Get Effective Term
+ * Purpose: Asks which term a catalog about to be loaded takes effect in
+ * Input: history - catalog history (the term must be later than its latest term), term - reference to
+ *        the term code (0 = load without recording history)
+ * Output: true if the answer is empty or a valid term, false (with an error) otherwise
+ */
+bool getEffectiveTerm(const CatalogHistory& history, int& term) {
+    term = 0;
+    cout << "Effective term of this catalog (e.g. Fall 2024), or Enter to load without history: ";
+    string text;
+    getline(cin, text);
+    if (text.find_first_not_of(" \t\r") == string::npos) {
+        return true;
+    }
+
+    if (!parseTerm(text, term)) {
+        cout << "Error: '" << text << "' is not a term (use a season and year, e.g. Fall 2024)" << endl;
+        return false;
+    }
+    if (!history.terms.empty() && term <= history.terms.back()) {
+        cout << "Error: Terms must be loaded in order; the latest recorded term is "
+            << formatTerm(history.terms.back()) << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Function: Menu Option 1 - Load Data Structure
+ * Purpose: Handles loading course data into hash table with comprehensive error handling
+ * Input: filename - catalog file, directory or ';'-separated list (several files load concurrently;
+ *        empty = the built-in catalog), table - reference to hash table to populate, nameIndex - reference to name index to rebuild,
+ *        suggestionIndex - reference to course number suggestion index to rebuild,
+ *        dependencyIndex - reference to reverse prerequisite index to rebuild,
+ *        compactCatalog - reference to structure-of-arrays copy used for listing,
+ *        courseLog - edit log (when open, the loaded table becomes its new checkpoint),
+ *        history - catalog history (a load with an effective term asks for that term's file, replaces
+ *        the table and is recorded and saved to CATALOG_HISTORY_PATH)
+ * Output: Hash table is populated with validated course data
+ */
+void menuOption1(const string& filename, HashTable& table, NameIndex& nameIndex, SuggestionIndex& suggestionIndex,
+    DependencyIndex& dependencyIndex, CompactCatalog& compactCatalog, CourseLog& courseLog, CatalogHistory& history) {
+    // An effective term keeps the previous catalog in the history instead of overwriting it
+    int term = 0;
+    if (!getEffectiveTerm(history, term)) {
+        return;
+    }
+
+    // Each term has its own catalog file; the startup file is only the default
+    string source = filename;
+    if (term != 0) {
+        cout << "Catalog file for " << formatTerm(term) << " (Enter for "
+            << (filename.empty() ? string("the built-in catalog") : "'" + filename + "'") << "): ";
+        string input;
+        getline(cin, input);
+        input = trimFilename(input);
+        if (!input.empty()) {
+            vector<string> files;
+            if (!expandCatalogSources(input, files)) {
+                return;
+            }
+            source = input;
+        }
+    }
+
+    cout << "\nLoading data structure..." << endl;
+
+    INSTRUMENT_PHASES_RESET();
+    INSTRUMENT_PHASE_START(loadTimer);
+
+    if (term == 0) {
+        if (!loadCatalogSource(filename, table)) {
+            return;
+        }
+    }
+    else {
+        // A term's catalog is complete: load it on its own, then record what changed
+        HashTable loaded = initializeHashTable(16);
+        TermChanges changes;
+        if (!loadCatalogSource(source, loaded) || !recordCatalogTerm(history, loaded, term, changes)) {
+            loaded.verbose = false;
+            cleanupHashTable(loaded);
+            return;
+        }
+        table.verbose = false;
+        cleanupHashTable(table);
+        table = loaded;
+
+        cout << "Catalog history: " << formatTerm(term) << " recorded (" << changes.added << " added, "
+            << changes.changed << " changed, " << changes.withdrawn << " withdrawn, " << changes.unchanged
+            << " unchanged); " << history.records << " records for " << history.terms.size()
+            << (history.terms.size() == 1 ? " term, " : " terms, ")
+            << getCatalogHistoryBytes(history) << " bytes" << endl;
+        if (!saveCatalogHistory(history)) {
+            cout << "Warning: " << formatTerm(term) << " is recorded for this session only" << endl;
+        }
+    }
+
+    cout << "Courses loaded successfully into hash table!" << endl;
+    cout << "Number of courses loaded: " << table.size << endl;
+    cout << "Hash table capacity: " << table.capacity << endl;
+    cout << "Current load factor: " << getLoadFactor(table) << endl;
+
+    // Display detailed hash table statistics
+    displayHashTableStats(table);
+    INSTRUMENT_PHASE_START(indexTimer);
+
+    // Step 4: Rebuild the course name search index
+    buildNameIndex(table, nameIndex);
+    size_t indexBytes = getNameIndexBytes(nameIndex);
+    cout << "Name index: " << nameIndex.terms.size() << " terms, " << indexBytes << " bytes ("
+        << fixed << setprecision(1) << (double)indexBytes / table.size << " bytes per course)" << endl;
+
+    // Step 5: Rebuild the "did you mean" index used when a lookup misses
+    buildSuggestionIndex(table, suggestionIndex);
+    indexBytes = getSuggestionIndexBytes(suggestionIndex);
+    cout << "Suggestion index: " << suggestionIndex.entries.size() << " variants, " << indexBytes << " bytes ("
+        << (double)indexBytes / table.size << " bytes per course)" << endl;
+
+    // Step 6: Rebuild the reverse prerequisite index (also drops memoized impact sets)
+    buildDependencyIndex(table, dependencyIndex);
+
+    // Step 7: Rebuild the compact copy used for listing and report the memory per course
+    TableMemory tableMemory;
+    measureHashTableMemory(table, tableMemory);
+    size_t tableBytes = getTableMemoryTotal(tableMemory, false);
+    cout << "Course storage: hash table " << tableBytes << " bytes ("
+        << (double)tableBytes / table.size << " bytes per course, "
+        << (double)getTableMemoryTotal(tableMemory, true) / table.size << " with allocator overhead)";
+    if (buildCompactCatalog(table, compactCatalog)) {
+        size_t compactBytes = getCompactCatalogBytes(compactCatalog);
+        cout << ", compact " << compactBytes << " bytes (" << (double)compactBytes / table.size << " bytes per course)";
+    }
+    else {
+        cout << endl << "Warning: Course numbers longer than " << COMPACT_KEY_WIDTH
+            << " characters; listing uses the hash table";
+    }
+    cout << endl;
+
+    // Step 8: Keep the durable copy in step with the table once edits are enabled
+    if (courseLog.fd >= 0 && checkpointCourseLog(courseLog, table)) {
+        cout << "Checkpoint written to " << courseLog.checkpointPath << endl;
+    }
+    INSTRUMENT_PHASE_LAP(indexTimer, PHASE_INDEXES);
+    INSTRUMENT_PHASE_LAP(loadTimer, PHASE_TOTAL);
+}
+
+/**
+ * Function: Menu Option 2 - Print Course List
+ * Purpose: Prints all courses in alphanumeric order with error handling
+ * Input: table - hash table containing courses, compactCatalog - sorted compact copy (used when current);
+ *        the built-in catalog is listed when nothing is loaded
+ * Output: All courses displayed in alphanumeric order by course number
+ */
+void menuOption2(const HashTable& table, const CompactCatalog& compactCatalog) {
+    if (table.size == 0 && EMBEDDED_COURSE_COUNT > 0) {
+        // Built-in records are generated in course number order
+        printPaginated(EMBEDDED_COURSE_COUNT, [](size_t id) {
+            cout << EMBEDDED_COURSES[id].courseNumber << ", " << EMBEDDED_COURSES[id].name << endl;
+        });
+        return;
+    }
+    if (table.size > 0 && compactCatalog.keys.size() == (size_t)table.size) {
+        printAllCoursesCompact(compactCatalog);
+        return;
+    }
+    printAllCoursesSorted(table);
+}
+
+/**
+ * Function: Menu Option 3 - Print Course
+ * Purpose: Searches for and displays specific course information with prerequisites
+ * Input: table - hash table containing courses (the built-in catalog answers when it is empty),
+ *        suggestionIndex - index used only when the lookup misses,
+ *        history - catalog history (once a term is recorded, the course can be shown as of a term)
+ * Output: Displays course information and prerequisites, or error message with suggestions
+ */
+void menuOption3(const HashTable& table, const SuggestionIndex& suggestionIndex, const CatalogHistory& history) {
+    if (table.size == 0 && EMBEDDED_COURSE_COUNT == 0 && history.terms.empty()) {
+        cout << "No courses loaded. Please load data first using option 1." << endl;
+        return;
+    }
+
+    string courseNumber;
+    cout << "What course do you want to know about? ";
+    getline(cin, courseNumber);
+
+    if (courseNumber.empty()) {
+        cout << "Error: Course number cannot be empty" << endl;
+        return;
+    }
+
+    // Convert to uppercase for case-insensitive search
+    for (char& c : courseNumber) {
+        c = toupper(c);
+    }
+
+    // Point-in-time lookup against the recorded term catalogs
+    if (!history.terms.empty()) {
+        cout << "As of term (e.g. Fall 2024), or Enter for the current catalog: ";
+        string termText;
+        getline(cin, termText);
+        int asOfTerm = 0;
+        if (termText.find_first_not_of(" \t\r") != string::npos) {
+            if (!parseTerm(termText, asOfTerm)) {
+                cout << "Error: '" << termText << "' is not a term (use a season and year, e.g. Fall 2024)" << endl;
+                return;
+            }
+            if (asOfTerm < history.terms.front()) {
+                cout << "No catalog is recorded before " << formatTerm(history.terms.front()) << "." << endl;
+                return;
+            }
+
+            const CourseVersion* version = findCourseVersion(history, courseNumber, asOfTerm);
+            if (version == nullptr) {
+                cout << "Course '" << courseNumber << "' was not offered in " << formatTerm(asOfTerm) << "." << endl;
+                return;
+            }
+            cout << endl << "Course Information (" << formatTerm(asOfTerm) << "):" << endl;
+            cout << "===================" << endl;
+            printCourseInfo(version->course);
+            cout << "In effect: " << formatTerm(version->fromTerm)
+                << (version->toTerm == TERM_OPEN ? " onward" : " until " + formatTerm(version->toTerm)) << endl;
+            cout << endl;
+            printPrerequisites(version->course, history, asOfTerm);
+            return;
+        }
+    }
+
+    // Nothing loaded yet: answer from the built-in catalog without loading it
+    if (table.size == 0) {
+        if (EMBEDDED_COURSE_COUNT == 0) {
+            cout << "No courses loaded. Please load data first using option 1, or enter a recorded term." << endl;
+            return;
+        }
+        const EmbeddedCourse* embedded = findEmbeddedCourse(courseNumber);
+        if (embedded != nullptr) {
+            cout << endl << "Course Information:" << endl;
+            cout << "===================" << endl;
+            printEmbeddedCourse(*embedded);
+        }
+        else {
+            cout << "Course '" << courseNumber << "' not found." << endl;
+            cout << "Please check the course number and try again." << endl;
+        }
+        return;
+    }
+
+    Course foundCourse;
+    if (searchCourse(table, courseNumber, foundCourse)) {
+        cout << endl << "Course Information:" << endl;
+        cout << "===================" << endl;
+        printCourseInfo(foundCourse);
+        cout << endl;
+        printPrerequisites(foundCourse, table);
+    }
+    else {
+        cout << "Course '" << courseNumber << "' not found." << endl;
+
+        vector<string> suggestions;
+        suggestCourses(suggestionIndex, courseNumber, SUGGESTION_COUNT, suggestions);
+        if (!suggestions.empty()) {
+            cout << "Did you mean: ";
+            for (size_t i = 0; i < suggestions.size(); i++) {
+                cout << suggestions[i] << (i + 1 < suggestions.size() ? ", " : "?\n");
+            }
+        }
+        cout << "Please check the course number and try again." << endl;
+    }
+}
+
+/**
+ * Function: Menu Option 4 - Search Course Names
+ * Purpose: Runs a keyword/phrase query over course names and lists ranked matches
+ * Input: table - hash table containing courses, nameIndex - index built at load time
+ * Output: Displays up to 20 best matches and the query time
+ */
+void menuOption4(const HashTable& table, const NameIndex& nameIndex) {
+    if (table.size == 0) {
+        cout << "No courses loaded. Please load data first using option 1." << endl;
+        return;
+    }
+
+    string query;
+    cout << "Enter keywords (use \"quotes\" for phrases, OR for alternatives): ";
+    getline(cin, query);
+
+    vector<NameMatch> matches;
+    auto start = chrono::steady_clock::now();
+    bool hasTerms = searchCourseNames(nameIndex, query, matches);
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+
+    if (!hasTerms) {
+        cout << "Error: Search must contain at least one keyword" << endl;
+        return;
+    }
+
+    if (matches.empty()) {
+        cout << "No courses match '" << query << "'." << endl;
+        return;
+    }
+
+    cout << endl << "Found " << matches.size() << " matching course(s) in "
+        << elapsed.count() << " microseconds:" << endl;
+
+    const size_t maxResults = 20;
+    for (size_t i = 0; i < matches.size() && i < maxResults; i++) {
+        Course course;
+        if (searchCourse(table, nameIndex.courseNumbers[matches[i].docId], course)) {
+            printCourseInfo(course);
+        }
+    }
+
+    if (matches.size() > maxResults) {
+        cout << "... and " << (matches.size() - maxResults) << " more" << endl;
+    }
+}
+
+/**
+ * Function: Print Course Number List
+ * Purpose: Prints course numbers separated by commas, 10 per line
+ * Input: courseNumbers - course numbers to print
+ */
+void printCourseNumberList(const vector<string>& courseNumbers) {
+    if (courseNumbers.empty()) {
+        cout << "  (none)" << endl;
+        return;
+    }
+
+    for (size_t i = 0; i < courseNumbers.size(); i++) {
+        if (i % 10 == 0) {
+            cout << "  ";
+        }
+        cout << courseNumbers[i];
+        if (i + 1 < courseNumbers.size()) {
+            cout << ",";
+        }
+        cout << ((i % 10 == 9 || i + 1 == courseNumbers.size()) ? "\n" : " ");
+    }
+}
+
+/**
+ * Function: Menu Option 5 - Show Dependent Courses
+ * Purpose: Shows which courses require a course directly and transitively
+ * Input: table - hash table containing courses, dependencyIndex - index built at load time
+ * Output: Displays direct dependents, the impact set and the query time
+ */
+void menuOption5(const HashTable& table, DependencyIndex& dependencyIndex) {
+    if (table.size == 0) {
+        cout << "No courses loaded. Please load data first using option 1." << endl;
+        return;
+    }
+
+    string courseNumber;
+    cout << "Which course's dependents do you want to see? ";
+    getline(cin, courseNumber);
+
+    // Convert to uppercase for case-insensitive search
+    for (char& c : courseNumber) {
+        c = toupper(c);
+    }
+
+    vector<string> direct;
+    vector<string> impacted;
+    auto start = chrono::steady_clock::now();
+    bool known = getDirectDependents(dependencyIndex, courseNumber, direct)
+        && getImpactSet(dependencyIndex, courseNumber, impacted);
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+
+    if (!known) {
+        cout << "Course '" << courseNumber << "' not found." << endl;
+        return;
+    }
+
+    cout << endl << "Courses that directly require " << courseNumber << ": " << direct.size() << endl;
+    printCourseNumberList(direct);
+    cout << "All courses affected if " << courseNumber << " changes: " << impacted.size() << endl;
+    printCourseNumberList(impacted);
+    cout << "Lookup time: " << elapsed.count() << " microseconds" << endl;
+}
+
+/**
+ * Function: Menu Option 6 - Show Runtime Statistics
+ * Purpose: Displays hot-path latency histograms and last-load phase timings,
+ *          and writes the same data to runtime_stats.json
+ * Output: Statistics table on the console and a JSON dump on disk
+ */
+void menuOption6() {
+    displayRuntimeStats();
+
+    const string statsPath = "runtime_stats.json";
+    if (writeRuntimeStatsJson(statsPath)) {
+        cout << "Machine-readable statistics written to " << statsPath << endl;
+    }
+}
+
+/**
+ * Function: Menu Option 11 - Show Memory Report
+ * Purpose: Displays the byte-level memory breakdown of the loaded table, the size of its indexes and
+ *          the load's peak RSS, and writes the same data to memory_report.json
+ * Input: table - hash table to measure, nameIndex, suggestionIndex - indexes to measure
+ * Output: Breakdown on the console and a JSON dump on disk
+ */
+void menuOption11(const HashTable& table, const NameIndex& nameIndex, const SuggestionIndex& suggestionIndex) {
+    displayMemoryReport(table, nameIndex, suggestionIndex);
+
+    const string reportPath = "memory_report.json";
+    if (writeMemoryReportJson(table, nameIndex, suggestionIndex, reportPath)) {
+        cout << "Machine-readable report written to " << reportPath << endl;
+    }
+}
+
+/**
+ * Function: Menu Option 7 - Validate File
+ * Purpose: Validates the catalog without loading it and reports every problem at once
+ * Input: filename - catalog file, directory or ';'-separated list (several files are validated together)
+ * Output: Summary and the first 50 issues on the console; the full report in validation_report.csv
+ */
+void menuOption7(const string& filename) {
+    if (filename.empty()) {
+        cout << "The built-in catalog was validated when it was generated." << endl;
+        return;
+    }
+
+    vector<string> files;
+    vector<CatalogFile> catalogs;
+    if (!expandCatalogSources(filename, files) || !readCatalogFiles(files, catalogs, false)) {
+        return;
+    }
+
+    vector<string> lines;
+    vector<size_t> lineNumbers;
+    RowSources sources;
+    concatenateCatalogs(catalogs, lines, lineNumbers, sources);
+
+    vector<ValidationIssue> issues;
+    auto start = chrono::steady_clock::now();
+    bool valid = validateFileCollectAll(lines, lineNumbers, issues, 0, files.size() > 1 ? &sources : nullptr);
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+    size_t counts[4] = { 0, 0, 0, 0 };
+    const char* kinds[4] = { "format", "duplicate", "dangling", "cycle" };
+    for (const ValidationIssue& issue : issues) {
+        for (int k = 0; k < 4; k++) {
+            counts[k] += issue.kind == kinds[k] ? 1 : 0;
+        }
+    }
+
+    cout << endl << "Validated " << lines.size() << " lines from " << files.size() << " file(s) in " << elapsed.count() << " ms using "
+        << max(1u, thread::hardware_concurrency()) << " thread(s)" << endl;
+    cout << "Format errors: " << counts[0] << ", duplicates: " << counts[1]
+        << ", dangling prerequisites: " << counts[2] << ", cycles: " << counts[3] << endl;
+    cout << (valid ? "File can be loaded." : "File cannot be loaded until format and dangling errors are fixed.") << endl;
+
+    if (issues.empty()) {
+        return;
+    }
+    printValidationIssues(issues, 50);
+
+    const string reportPath = "validation_report.csv";
+    ofstream report(reportPath);
+    if (!report.is_open()) {
+        cout << "Error: Cannot write '" << reportPath << "'" << endl;
+        return;
+    }
+    report << "file,line,column,kind,message" << endl;
+    for (const ValidationIssue& issue : issues) {
+        string message = issue.message;
+        size_t quote = 0;
+        while ((quote = message.find('"', quote)) != string::npos) {
+            message.insert(quote, "\"");
+            quote += 2;
+        }
+        report << "\"" << (issue.file.empty() ? files[0] : issue.file) << "\"," << issue.lineNumber << "," << issue.column << "," << issue.kind << ",\"" << message << "\"" << endl;
+    }
+    cout << "Full report (" << issues.size() << " issues) written to " << reportPath << endl;
+}
+
+/**
+ * Function: Menu Option 8 - Edit Course
+ * Purpose: Adds, updates or removes one course; the edit is logged and committed before returning
+ * Input: table - reference to hash table, courseLog - reference to edit log (opened on first edit),
+ *        nameIndex, suggestionIndex, dependencyIndex, compactCatalog - rebuilt after the edit
+ * Output: Table, log and indexes reflect the edit
+ */
+void menuOption8(HashTable& table, CourseLog& courseLog, NameIndex& nameIndex, SuggestionIndex& suggestionIndex,
+    DependencyIndex& dependencyIndex, CompactCatalog& compactCatalog) {
+    // After a failed recovery, a new log starts only when the user asks for it
+    if (courseLog.editingDisabled) {
+        if (fileExists(courseLog.checkpointPath) || fileExists(courseLog.logPath)) {
+            cout << "Error: Editing is off. Move '" << courseLog.checkpointPath << "' and '" << courseLog.logPath
+                << "' out of the way and restart to edit courses" << endl;
+            return;
+        }
+        string answer;
+        cout << "Saved edits could not be recovered (kept as *.damaged). Start a new edit log from the current catalog (Y/N)? ";
+        getline(cin, answer);
+        if (answer.empty() || toupper(answer[0]) != 'Y') {
+            cout << "Editing stays off" << endl;
+            return;
+        }
+        courseLog.editingDisabled = false;
+    }
+
+    string action;
+    cout << "Add, update or remove a course (A/U/R)? ";
+    getline(cin, action);
+    char kind = action.empty() ? ' ' : (char)toupper(action[0]);
+    if (kind != 'A' && kind != 'U' && kind != 'R') {
+        cout << "Error: Enter A, U or R" << endl;
+        return;
+    }
+
+    string courseNumber;
+    cout << "Course number: ";
+    getline(cin, courseNumber);
+    courseNumber = trimFilename(courseNumber);
+    for (char& c : courseNumber) {
+        c = toupper(c);
+    }
+    if (courseNumber.empty() || courseNumber.find(',') != string::npos) {
+        cout << "Error: Course number cannot be empty or contain commas" << endl;
+        return;
+    }
+
+    // Name and prerequisites go through the same parser as catalog lines
+    Course course;
+    if (kind != 'R') {
+        string name;
+        string prerequisites;
+        cout << "Course name: ";
+        getline(cin, name);
+        cout << "Prerequisites (comma separated, blank for none): ";
+        getline(cin, prerequisites);
+        for (char& c : prerequisites) {
+            c = toupper(c);
+        }
+        if (name.find(',') != string::npos || !createCourseObject(courseNumber + "," + name + "," + prerequisites, course)) {
+            cout << "Error: Course name is required and cannot contain commas" << endl;
+            return;
+        }
+    }
+    else {
+        vector<string> dependents;
+        if (getDirectDependents(dependencyIndex, courseNumber, dependents) && !dependents.empty()) {
+            cout << "Error: Cannot remove " << courseNumber << "; it is a prerequisite of:" << endl;
+            printCourseNumberList(dependents);
+            return;
+        }
+    }
+
+    // The first edit turns on logging, with the current table as the base checkpoint
+    if (courseLog.fd < 0 && !openCourseLog(courseLog, table)) {
+        return;
+    }
+
+    bool applied = kind == 'A' ? addCourse(courseLog, table, course)
+        : kind == 'U' ? updateCourse(courseLog, table, course)
+        : removeCourse(courseLog, table, courseNumber);
+    if (!applied || !commitCourseLog(courseLog, table)) {
+        return;
+    }
+
+    // Only the edited course changes in the name index; the other structures are rebuilt
+    updateNameIndex(table, nameIndex, courseNumber);
+    buildSuggestionIndex(table, suggestionIndex);
+    buildDependencyIndex(table, dependencyIndex);
+    buildCompactCatalog(table, compactCatalog);
+    cout << "Course " << courseNumber << (kind == 'A' ? " added" : kind == 'U' ? " updated" : " removed")
+        << " and saved to " << courseLog.logPath << " (edit " << courseLog.nextSequence - 1 << ")" << endl;
+}
+
+/**
+ * Function: Menu Option 10 - Export Catalog
+ * Purpose: Writes the loaded catalog to a columnar file for analytics jobs and reads it back to verify it
+ * Input: table - hash table containing courses, compactCatalog - sorted compact copy (rebuilt here if stale)
+ * Output: Export file written; sizes and export/import throughput displayed
+ */
+void menuOption10(const HashTable& table, CompactCatalog& compactCatalog) {
+    if (table.size == 0) {
+        cout << "No courses loaded. Please load data first using option 1." << endl;
+        return;
+    }
+
+    cout << "Export file (Enter for " << COLUMNAR_EXPORT_PATH << "): ";
+    string path;
+    getline(cin, path);
+    path = trimFilename(path);
+    if (path.empty()) {
+        path = COLUMNAR_EXPORT_PATH;
+    }
+
+    // The export is the compact catalog's columns, so it needs a current compact catalog
+    if (compactCatalog.keys.size() != (size_t)table.size && !buildCompactCatalog(table, compactCatalog)) {
+        cout << "Error: Course numbers longer than " << COMPACT_KEY_WIDTH << " characters cannot be exported" << endl;
+        return;
+    }
+
+    size_t fileBytes = 0;
+    auto start = chrono::steady_clock::now();
+    if (!exportColumnarCatalog(compactCatalog, path, fileBytes)) {
+        return;
+    }
+    double exportSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    CompactCatalog imported;
+    size_t bytesRead = 0;
+    start = chrono::steady_clock::now();
+    if (!importColumnarCatalog(path, PROJECT_ALL, imported, bytesRead)) {
+        return;
+    }
+    double importSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    bool same = imported.nameOffsets == compactCatalog.nameOffsets && imported.namePool == compactCatalog.namePool
+        && imported.prerequisiteOffsets == compactCatalog.prerequisiteOffsets
+        && imported.prerequisites == compactCatalog.prerequisites && imported.keys.size() == compactCatalog.keys.size()
+        && (imported.keys.empty() || memcmp(imported.keys.data(), compactCatalog.keys.data(),
+            imported.keys.size() * sizeof(PackedKey)) == 0);
+
+    ios::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    cout << fixed << setprecision(1);
+    cout << "Exported " << compactCatalog.keys.size() << " courses and " << compactCatalog.prerequisites.size()
+        << " prerequisites to " << path << " (" << formatByteCount(fileBytes) << ") in " << exportSeconds * 1000.0
+        << " ms" << endl;
+    cout << "Re-imported in " << importSeconds * 1000.0 << " ms: "
+        << (same ? "matches the loaded catalog" : "Error: does not match the loaded catalog") << endl;
+    cout.flags(flags);
+    cout.precision(precision);
+}
+
+// Tools that reuse this implementation (e.g. Benchmark.cpp) define PROJECTTWO_NO_MAIN
+// before including this file so they can supply their own entry point
+#ifndef PROJECTTWO_NO_MAIN
+int main() {
+
+    // Near the top of main(), after getting the filename:
+    HashTable courseTable = initializeHashTable(16);
+    NameIndex nameIndex;
+    SuggestionIndex suggestionIndex;
+    DependencyIndex dependencyIndex;
+    CompactCatalog compactCatalog;
+    CourseLog courseLog;
+    CatalogHistory catalogHistory;
+
+    cout << "Welcome to the ABCU Course Management System" << endl;
+    cout << "===========================================" << endl;
+
+    // Courses saved by earlier edits come back from the checkpoint and edit log
+    if (fileExists(COURSE_CHECKPOINT_PATH) || fileExists(COURSE_LOG_PATH)) {
+        CourseRecoveryStats recovery;
+        courseTable.verbose = false;
+        if (recoverCourseLog(courseLog, courseTable, recovery)) {
+            rebuildCourseIndexes(courseTable, nameIndex, suggestionIndex, dependencyIndex, compactCatalog);
+            cout << "Recovered " << courseTable.size << " courses (" << recovery.checkpointCourses
+                << " from checkpoint, " << recovery.logEdits << " logged edits) in "
+                << fixed << setprecision(1) << recovery.seconds * 1000.0 << " ms" << endl;
+            cout.unsetf(ios::fixed);
+            cout << setprecision(6);
+            if (recovery.discardedBytes > 0) {
+                cout << "Warning: Discarded " << recovery.discardedBytes << " bytes of an incomplete edit" << endl;
+            }
+        }
+        else {
+            // Start empty, keeping the unreadable files for the user to inspect or restore
+            cleanupHashTable(courseTable);
+            courseTable = initializeHashTable(16);
+            setAsideCourseLog(courseLog);
+        }
+        courseTable.verbose = true;
+    }
+
+    // Terms recorded in earlier sessions stay available to point-in-time lookups
+    if (fileExists(CATALOG_HISTORY_PATH)) {
+        if (loadCatalogHistory(catalogHistory)) {
+            cout << "Catalog history: " << catalogHistory.terms.size()
+                << (catalogHistory.terms.size() == 1 ? " term (" : " terms (") << formatTerm(catalogHistory.terms.front());
+            if (catalogHistory.terms.size() > 1) {
+                cout << " to " << formatTerm(catalogHistory.terms.back());
+            }
+            cout << ") restored from " << CATALOG_HISTORY_PATH << endl;
+        }
+        else {
+            setAsideDamagedFile(CATALOG_HISTORY_PATH);
+            cout << "Warning: Starting without catalog history" << endl;
+        }
+    }
+
+    string filename = getValidFilename();
+
+    cout << "Ready to process file: " << (filename.empty() ? "built-in catalog" : filename) << endl;
+
+    // Transition to menu system
+    cout << "\nWelcome to the course planner." << endl;
+
+    bool running = true;
+
+    while (running) {
+        displayMenu();
+        string choice = getMenuChoice();
+
+        if (!isValidMenuChoice(choice)) {
+            cout << choice << " is not a valid option." << endl;
+            continue;
+        }
+
+        if (choice == "1") {
+            menuOption1(filename, courseTable, nameIndex, suggestionIndex, dependencyIndex, compactCatalog, courseLog,
+                catalogHistory);
+        }
+        else if (choice == "2") {
+            menuOption2(courseTable, compactCatalog);
+        }
+        else if (choice == "3") {
+            menuOption3(courseTable, suggestionIndex, catalogHistory);
+        }
+        else if (choice == "4") {
+            menuOption4(courseTable, nameIndex);
+        }
+        else if (choice == "5") {
+            menuOption5(courseTable, dependencyIndex);
+        }
+        else if (choice == "6") {
+            menuOption6();
+        }
+        else if (choice == "7") {
+            menuOption7(filename);
+        }
+        else if (choice == "8") {
+            menuOption8(courseTable, courseLog, nameIndex, suggestionIndex, dependencyIndex, compactCatalog);
+        }
+        else if (choice == "10") {
+            menuOption10(courseTable, compactCatalog);
+        }
+        else if (choice == "11") {
+            menuOption11(courseTable, nameIndex, suggestionIndex);
+        }
+        else if (choice == "9") {
+            closeCourseLog(courseLog, courseTable);
+            cout << "\nCleaning up memory..." << endl;
+            cleanupHashTable(courseTable);
+            cout << "\nThank you for using the course planner!\n" << endl;
+            cout << "Press Enter to exit...";
+            cin.get(); // Wait for user to press Enter before exiting
+            running = false;
+        }
+    }
+    
+
+    return 0;
+}
+#endif